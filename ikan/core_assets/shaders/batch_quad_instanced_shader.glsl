@@ -0,0 +1,87 @@
+//
+//  batch_quad_instanced_shader.glsl
+//  ikan
+//
+//  Created by iKan on 17/10/26.
+//
+
+// vertex Shader
+#type vertex
+#version 330 core
+
+// Per vertex: corner of unit quad (0 or 1 in each axis)
+layout(location = 0) in vec2  a_Corner;
+
+// Per instance: 2x2 affine (x axis, y axis), translation, UV rect (min, max), color as normalized RGBA8 and
+// TexIndex in first byte
+layout(location = 1) in vec4  a_Affine;
+layout(location = 2) in vec3  a_Translation;
+layout(location = 3) in vec4  a_UVRect;
+layout(location = 4) in vec4  a_Color;
+layout(location = 5) in vec4  a_TexIndex;
+layout(location = 6) in int   a_ObjectID;
+
+uniform mat4 u_ViewProjection;
+
+out VS_OUT
+{
+  vec4  Color;
+  vec2  TexCoord;
+  float TexIndex;
+  float ObjectID;
+} vs_out;
+
+void main()
+{
+  vs_out.Color         = a_Color;
+  vs_out.TexCoord      = mix(a_UVRect.xy, a_UVRect.zw, a_Corner);
+  vs_out.TexIndex      = a_TexIndex.x;
+  vs_out.ObjectID      = a_ObjectID;
+  
+  vec2 position = mat2(a_Affine.xy, a_Affine.zw) * (a_Corner - 0.5) + a_Translation.xy;
+  gl_Position = u_ViewProjection * vec4(position, a_Translation.z, 1.0);
+}
+
+// Fragment Shader
+#type fragment
+#version 330 core
+layout(location = 0) out vec4 o_Color;
+layout(location = 1) out int  o_IDBuffer;
+
+in VS_OUT
+{
+  vec4  Color;
+  vec2  TexCoord;
+  float TexIndex;
+  float ObjectID;
+} fs_in;
+
+uniform sampler2D u_Textures[16];
+
+void main()
+{
+  vec4 texColor = fs_in.Color;
+  switch(int(fs_in.TexIndex))
+  {
+    case 0: texColor *= texture(u_Textures[0], fs_in.TexCoord); break;
+    case 1: texColor *= texture(u_Textures[1], fs_in.TexCoord); break;
+    case 2: texColor *= texture(u_Textures[2], fs_in.TexCoord); break;
+    case 3: texColor *= texture(u_Textures[3], fs_in.TexCoord); break;
+    case 4: texColor *= texture(u_Textures[4], fs_in.TexCoord); break;
+    case 5: texColor *= texture(u_Textures[5], fs_in.TexCoord); break;
+    case 6: texColor *= texture(u_Textures[6], fs_in.TexCoord); break;
+    case 7: texColor *= texture(u_Textures[7], fs_in.TexCoord); break;
+    case 8: texColor *= texture(u_Textures[8], fs_in.TexCoord); break;
+    case 9: texColor *= texture(u_Textures[9], fs_in.TexCoord); break;
+    case 10: texColor *= texture(u_Textures[10], fs_in.TexCoord); break;
+    case 11: texColor *= texture(u_Textures[11], fs_in.TexCoord); break;
+    case 12: texColor *= texture(u_Textures[12], fs_in.TexCoord); break;
+    case 13: texColor *= texture(u_Textures[13], fs_in.TexCoord); break;
+    case 14: texColor *= texture(u_Textures[14], fs_in.TexCoord); break;
+    case 15: texColor *= texture(u_Textures[15], fs_in.TexCoord); break;
+  }
+  if(texColor.a < 0.1)
+    discard;
+  o_Color = texColor;
+  o_IDBuffer = int(fs_in.ObjectID);
+}
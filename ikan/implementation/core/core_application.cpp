@@ -112,9 +112,16 @@ namespace ikan {
       // Window update each frame
       window_->Update();
       
+      // Resize the 2D batches once per frame, from the flushes of previous frame (a frame can begin multiple batches). Called before
+      // stats are reset, as flushed elements are checked against the submitted ones
+      Renderer::UpdateBatchCapacity();
+      
       // Reset Statistics each frame
       Renderer::ResetStatsEachFrame();
       
+      // Upload the textures decoded on worker threads and evict unused textures
+      Renderer::UpdateTextureLibrary();
+      
       // Updating all the attached layer
       for (auto& layer : layer_stack_)
         layer->Update(time_step_);
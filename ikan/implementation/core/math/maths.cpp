@@ -7,6 +7,16 @@
 
 #include "maths.hpp"
 
+#include <random>
+
+#if defined(__SSE__) or defined(__x86_64__)
+#include <immintrin.h>
+#define IK_MATH_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define IK_MATH_NEON 1
+#endif
+
 namespace ikan {
   
   void Math::DecomposeTransform(const glm::mat4& transform, glm::vec3& out_translation, glm::vec3& out_rotation, glm::vec3& out_scale) {
@@ -67,4 +77,209 @@ namespace ikan {
     return {cartisian.x - cartisian.y, (cartisian.x + cartisian.y) / 2};
   }
   
+  // Sign of each corner of quad
+  static constexpr float corner_sign_x_[4] = { -1.0f,  1.0f, 1.0f, -1.0f };
+  static constexpr float corner_sign_y_[4] = { -1.0f, -1.0f, 1.0f,  1.0f };
+  
+  void Math::GetQuadCorners2D(const glm::vec2& center, const glm::vec2& half_extent, float cos_rotation, float sin_rotation,
+                              float out_x[4], float out_y[4]) {
+    // All 4 corners are computed in one lane each:
+    //   x = cx + (sx * hx) * c - (sy * hy) * s
+    //   y = cy + (sx * hx) * s + (sy * hy) * c
+#if IK_MATH_SSE
+    __m128 lx = _mm_mul_ps(_mm_loadu_ps(corner_sign_x_), _mm_set1_ps(half_extent.x));
+    __m128 ly = _mm_mul_ps(_mm_loadu_ps(corner_sign_y_), _mm_set1_ps(half_extent.y));
+    __m128 c = _mm_set1_ps(cos_rotation);
+    __m128 s = _mm_set1_ps(sin_rotation);
+    
+    __m128 x = _mm_add_ps(_mm_set1_ps(center.x), _mm_sub_ps(_mm_mul_ps(lx, c), _mm_mul_ps(ly, s)));
+    __m128 y = _mm_add_ps(_mm_set1_ps(center.y), _mm_add_ps(_mm_mul_ps(lx, s), _mm_mul_ps(ly, c)));
+    _mm_storeu_ps(out_x, x);
+    _mm_storeu_ps(out_y, y);
+#elif IK_MATH_NEON
+    float32x4_t lx = vmulq_n_f32(vld1q_f32(corner_sign_x_), half_extent.x);
+    float32x4_t ly = vmulq_n_f32(vld1q_f32(corner_sign_y_), half_extent.y);
+    
+    float32x4_t x = vmlsq_n_f32(vmlaq_n_f32(vdupq_n_f32(center.x), lx, cos_rotation), ly, sin_rotation);
+    float32x4_t y = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(center.y), lx, sin_rotation), ly, cos_rotation);
+    vst1q_f32(out_x, x);
+    vst1q_f32(out_y, y);
+#else
+    GetQuadCorners2DScalar(center, half_extent, cos_rotation, sin_rotation, out_x, out_y);
+#endif
+  }
+  
+  void Math::GetQuadCorners2DScalar(const glm::vec2& center, const glm::vec2& half_extent, float cos_rotation, float sin_rotation,
+                                    float out_x[4], float out_y[4]) {
+    for (uint32_t i = 0; i < 4; i++) {
+      float lx = corner_sign_x_[i] * half_extent.x;
+      float ly = corner_sign_y_[i] * half_extent.y;
+      out_x[i] = center.x + lx * cos_rotation - ly * sin_rotation;
+      out_y[i] = center.y + lx * sin_rotation + ly * cos_rotation;
+    }
+  }
+
+  // Bulk corners are computed with one quad per lane. With a = hx * c, b = hy * s, e = hx * s, f = hy * c:
+  //   x = { cx - a + b, cx + a + b, cx + a - b, cx - a - b }
+  //   y = { cy - e - f, cy + e - f, cy + e + f, cy - e + f }
+  // and lanes are transposed to quad major order before store. Each function returns the index of first quad not processed
+#if IK_MATH_SSE
+  __attribute__((target("avx")))
+  static size_t GetQuadCorners2DBulkAVX(size_t first, size_t count, const glm::vec3* p, const glm::vec2* h, const float* cos_rotations,
+                                        const float* sin_rotations, float* out_x, float* out_y) {
+    size_t q = first;
+    for (; q + 8 <= count; q += 8) {
+      const __m256 cx = _mm256_setr_ps(p[q].x, p[q + 1].x, p[q + 2].x, p[q + 3].x, p[q + 4].x, p[q + 5].x, p[q + 6].x, p[q + 7].x);
+      const __m256 cy = _mm256_setr_ps(p[q].y, p[q + 1].y, p[q + 2].y, p[q + 3].y, p[q + 4].y, p[q + 5].y, p[q + 6].y, p[q + 7].y);
+      const __m256 hx = _mm256_setr_ps(h[q].x, h[q + 1].x, h[q + 2].x, h[q + 3].x, h[q + 4].x, h[q + 5].x, h[q + 6].x, h[q + 7].x);
+      const __m256 hy = _mm256_setr_ps(h[q].y, h[q + 1].y, h[q + 2].y, h[q + 3].y, h[q + 4].y, h[q + 5].y, h[q + 6].y, h[q + 7].y);
+      const __m256 c = cos_rotations ? _mm256_loadu_ps(cos_rotations + q) : _mm256_set1_ps(1.0f);
+      const __m256 s = sin_rotations ? _mm256_loadu_ps(sin_rotations + q) : _mm256_setzero_ps();
+      const __m256 a = _mm256_mul_ps(hx, c), b = _mm256_mul_ps(hy, s), e = _mm256_mul_ps(hx, s), f = _mm256_mul_ps(hy, c);
+
+      const __m256 cx_m = _mm256_sub_ps(cx, a), cx_p = _mm256_add_ps(cx, a);
+      const __m256 cy_m = _mm256_sub_ps(cy, e), cy_p = _mm256_add_ps(cy, e);
+      const __m256 x[4] = { _mm256_add_ps(cx_m, b), _mm256_add_ps(cx_p, b), _mm256_sub_ps(cx_p, b), _mm256_sub_ps(cx_m, b) };
+      const __m256 y[4] = { _mm256_sub_ps(cy_m, f), _mm256_sub_ps(cy_p, f), _mm256_add_ps(cy_p, f), _mm256_add_ps(cy_m, f) };
+
+      float* outputs[2] = { out_x + q * 4, out_y + q * 4 };
+      const __m256* corners[2] = { x, y };
+      for (uint32_t axis = 0; axis < 2; axis++) {
+        // 4x4 transpose in each 128 bit half gives one quad per half (q04 = { quad 0 | quad 4 }), then halves are regrouped
+        const __m256* r = corners[axis];
+        const __m256 t0 = _mm256_unpacklo_ps(r[0], r[1]), t1 = _mm256_unpackhi_ps(r[0], r[1]);
+        const __m256 t2 = _mm256_unpacklo_ps(r[2], r[3]), t3 = _mm256_unpackhi_ps(r[2], r[3]);
+        const __m256 q04 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)), q15 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 q26 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)), q37 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm256_storeu_ps(outputs[axis], _mm256_permute2f128_ps(q04, q15, 0x20));
+        _mm256_storeu_ps(outputs[axis] + 8, _mm256_permute2f128_ps(q26, q37, 0x20));
+        _mm256_storeu_ps(outputs[axis] + 16, _mm256_permute2f128_ps(q04, q15, 0x31));
+        _mm256_storeu_ps(outputs[axis] + 24, _mm256_permute2f128_ps(q26, q37, 0x31));
+      }
+    }
+    return q;
+  }
+
+  static size_t GetQuadCorners2DBulkSSE(size_t first, size_t count, const glm::vec3* p, const glm::vec2* h, const float* cos_rotations,
+                                        const float* sin_rotations, float* out_x, float* out_y) {
+    size_t q = first;
+    for (; q + 4 <= count; q += 4) {
+      const __m128 cx = _mm_setr_ps(p[q].x, p[q + 1].x, p[q + 2].x, p[q + 3].x);
+      const __m128 cy = _mm_setr_ps(p[q].y, p[q + 1].y, p[q + 2].y, p[q + 3].y);
+      const __m128 hx = _mm_setr_ps(h[q].x, h[q + 1].x, h[q + 2].x, h[q + 3].x);
+      const __m128 hy = _mm_setr_ps(h[q].y, h[q + 1].y, h[q + 2].y, h[q + 3].y);
+      const __m128 c = cos_rotations ? _mm_loadu_ps(cos_rotations + q) : _mm_set1_ps(1.0f);
+      const __m128 s = sin_rotations ? _mm_loadu_ps(sin_rotations + q) : _mm_setzero_ps();
+      const __m128 a = _mm_mul_ps(hx, c), b = _mm_mul_ps(hy, s), e = _mm_mul_ps(hx, s), f = _mm_mul_ps(hy, c);
+
+      const __m128 cx_m = _mm_sub_ps(cx, a), cx_p = _mm_add_ps(cx, a);
+      const __m128 cy_m = _mm_sub_ps(cy, e), cy_p = _mm_add_ps(cy, e);
+      __m128 x0 = _mm_add_ps(cx_m, b), x1 = _mm_add_ps(cx_p, b), x2 = _mm_sub_ps(cx_p, b), x3 = _mm_sub_ps(cx_m, b);
+      __m128 y0 = _mm_sub_ps(cy_m, f), y1 = _mm_sub_ps(cy_p, f), y2 = _mm_add_ps(cy_p, f), y3 = _mm_add_ps(cy_m, f);
+      _MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+      _MM_TRANSPOSE4_PS(y0, y1, y2, y3);
+
+      float* dst_x = out_x + q * 4;
+      float* dst_y = out_y + q * 4;
+      _mm_storeu_ps(dst_x, x0); _mm_storeu_ps(dst_x + 4, x1); _mm_storeu_ps(dst_x + 8, x2); _mm_storeu_ps(dst_x + 12, x3);
+      _mm_storeu_ps(dst_y, y0); _mm_storeu_ps(dst_y + 4, y1); _mm_storeu_ps(dst_y + 8, y2); _mm_storeu_ps(dst_y + 12, y3);
+    }
+    return q;
+  }
+#elif IK_MATH_NEON
+  static size_t GetQuadCorners2DBulkNEON(size_t first, size_t count, const glm::vec3* p, const glm::vec2* h, const float* cos_rotations,
+                                         const float* sin_rotations, float* out_x, float* out_y) {
+    size_t q = first;
+    for (; q + 4 <= count; q += 4) {
+      const float cx_lanes[4] = { p[q].x, p[q + 1].x, p[q + 2].x, p[q + 3].x };
+      const float cy_lanes[4] = { p[q].y, p[q + 1].y, p[q + 2].y, p[q + 3].y };
+      const float hx_lanes[4] = { h[q].x, h[q + 1].x, h[q + 2].x, h[q + 3].x };
+      const float hy_lanes[4] = { h[q].y, h[q + 1].y, h[q + 2].y, h[q + 3].y };
+      const float32x4_t cx = vld1q_f32(cx_lanes), cy = vld1q_f32(cy_lanes);
+      const float32x4_t hx = vld1q_f32(hx_lanes), hy = vld1q_f32(hy_lanes);
+      const float32x4_t c = cos_rotations ? vld1q_f32(cos_rotations + q) : vdupq_n_f32(1.0f);
+      const float32x4_t s = sin_rotations ? vld1q_f32(sin_rotations + q) : vdupq_n_f32(0.0f);
+      const float32x4_t a = vmulq_f32(hx, c), b = vmulq_f32(hy, s), e = vmulq_f32(hx, s), f = vmulq_f32(hy, c);
+
+      const float32x4_t cx_m = vsubq_f32(cx, a), cx_p = vaddq_f32(cx, a);
+      const float32x4_t cy_m = vsubq_f32(cy, e), cy_p = vaddq_f32(cy, e);
+      // vst4q interleaves the 4 corner registers, which stores 4 corners of each quad contiguously
+      const float32x4x4_t x = { { vaddq_f32(cx_m, b), vaddq_f32(cx_p, b), vsubq_f32(cx_p, b), vsubq_f32(cx_m, b) } };
+      const float32x4x4_t y = { { vsubq_f32(cy_m, f), vsubq_f32(cy_p, f), vaddq_f32(cy_p, f), vaddq_f32(cy_m, f) } };
+      vst4q_f32(out_x + q * 4, x);
+      vst4q_f32(out_y + q * 4, y);
+    }
+    return q;
+  }
+#endif
+
+  void Math::GetQuadCorners2DBulk(size_t count, const glm::vec3* centers, const glm::vec2* half_extents, const float* cos_rotations,
+                                  const float* sin_rotations, float* out_x, float* out_y) {
+    size_t q = 0;
+#if IK_MATH_SSE
+    static const bool has_avx = __builtin_cpu_supports("avx");
+    if (has_avx) {
+      q = GetQuadCorners2DBulkAVX(q, count, centers, half_extents, cos_rotations, sin_rotations, out_x, out_y);
+    }
+    q = GetQuadCorners2DBulkSSE(q, count, centers, half_extents, cos_rotations, sin_rotations, out_x, out_y);
+#elif IK_MATH_NEON
+    q = GetQuadCorners2DBulkNEON(q, count, centers, half_extents, cos_rotations, sin_rotations, out_x, out_y);
+#endif
+    for (; q < count; q++) {
+      const glm::vec3& center = centers[q];
+      const glm::vec2& half_extent = half_extents[q];
+      const float c = cos_rotations ? cos_rotations[q] : 1.0f, s = sin_rotations ? sin_rotations[q] : 0.0f;
+      const float a = half_extent.x * c, b = half_extent.y * s, e = half_extent.x * s, f = half_extent.y * c;
+      float* dst_x = out_x + q * 4;
+      float* dst_y = out_y + q * 4;
+      dst_x[0] = center.x - a + b; dst_x[1] = center.x + a + b; dst_x[2] = center.x + a - b; dst_x[3] = center.x - a - b;
+      dst_y[0] = center.y - e - f; dst_y[1] = center.y + e - f; dst_y[2] = center.y + e + f; dst_y[3] = center.y - e + f;
+    }
+  }
+
+  uint32_t Math::ValidateQuadCorners2D(uint32_t num_samples) {
+    // Fixed seed, so that a failure can be reproduced
+    std::mt19937 generator(0x1CA4);
+    std::uniform_real_distribution<float> position(-10000.0f, 10000.0f);
+    std::uniform_real_distribution<float> size(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> angle(-glm::pi<float>(), glm::pi<float>());
+    
+    std::vector<glm::vec3> centers(num_samples);
+    std::vector<glm::vec2> half_extents(num_samples);
+    std::vector<float> cos_rotations(num_samples), sin_rotations(num_samples);
+    for (uint32_t sample = 0; sample < num_samples; sample++) {
+      centers[sample] = { position(generator), position(generator), 0.0f };
+      half_extents[sample] = { size(generator), size(generator) };
+      const float rotation = angle(generator);
+      cos_rotations[sample] = std::cos(rotation);
+      sin_rotations[sample] = std::sin(rotation);
+    }
+    
+    std::vector<float> bulk_x(num_samples * 4), bulk_y(num_samples * 4);
+    GetQuadCorners2DBulk(num_samples, centers.data(), half_extents.data(), cos_rotations.data(), sin_rotations.data(), bulk_x.data(),
+                         bulk_y.data());
+    
+    uint32_t mismatches = 0;
+    for (uint32_t sample = 0; sample < num_samples; sample++) {
+      const glm::vec2 center = centers[sample];
+      const glm::vec2& half_extent = half_extents[sample];
+      float simd_x[4], simd_y[4], scalar_x[4], scalar_y[4];
+      GetQuadCorners2D(center, half_extent, cos_rotations[sample], sin_rotations[sample], simd_x, simd_y);
+      GetQuadCorners2DScalar(center, half_extent, cos_rotations[sample], sin_rotations[sample], scalar_x, scalar_y);
+      
+      // SIMD may round in different order. Epsilon is relative to the magnitude of inputs
+      const float epsilon = 1e-5f * (std::abs(center.x) + std::abs(center.y) + half_extent.x + half_extent.y + 1.0f);
+      for (uint32_t i = 0; i < 4; i++) {
+        const float bx = bulk_x[sample * 4 + i], by = bulk_y[sample * 4 + i];
+        if (std::abs(simd_x[i] - scalar_x[i]) > epsilon or std::abs(simd_y[i] - scalar_y[i]) > epsilon or
+            std::abs(bx - scalar_x[i]) > epsilon or std::abs(by - scalar_y[i]) > epsilon) {
+          IK_CORE_ERROR(LogModule::Renderer, "Quad corner {0} mismatch. SIMD ({1}, {2}), Bulk ({3}, {4}), Scalar ({5}, {6})", i,
+                        simd_x[i], simd_y[i], bx, by, scalar_x[i], scalar_y[i]);
+          mismatches++;
+        }
+      }
+    }
+    return mismatches;
+  }
+  
 } // namespace ikan
@@ -29,6 +29,8 @@ namespace ikan {
       case ShaderDataType::Int3:     return GL_INT;
       case ShaderDataType::Int4:     return GL_INT;
       case ShaderDataType::Bool:     return GL_BOOL;
+      case ShaderDataType::Half2:    return GL_HALF_FLOAT;
+      case ShaderDataType::UByte4:   return GL_UNSIGNED_BYTE;
     }
     
     IK_CORE_ASSERT(false, "Unknown ShaderDataType!");
@@ -51,6 +53,8 @@ namespace ikan {
       case ShaderDataType::Int3:     return "Int3  ";
       case ShaderDataType::Int4:     return "Int4  ";
       case ShaderDataType::Bool:     return "Bool  ";
+      case ShaderDataType::Half2:    return "Half2 ";
+      case ShaderDataType::UByte4:   return "UByte4";
     }
     
     IK_CORE_ASSERT(false, "Unknown ShaderDataType!");
@@ -92,7 +96,8 @@ namespace ikan {
     glBindVertexArray(renderer_id_);
     vertex_buffers_.push_back(vertex_buffers);
 
-    uint32_t index = 0;
+    // Attribute index continues from previous vertex buffers, so that per vertex and per instance buffers can share pipeline
+    uint32_t& index = vertex_attribute_index_;
     const auto& layout = vertex_buffers->GetLayout();
     
     PIPELINE_LOG("  Storing the Vertex Buffer (ID: {0}) into Pipeline (ID: {1}). Total vertrd buffers in pipeline are {2}",
@@ -112,6 +117,8 @@ namespace ikan {
           glEnableVertexAttribArray(index);
           glVertexAttribIPointer(index, (int)element.count, ShaderDataTypeToOpenGLBaseType(element.type),
                                  (int)layout.GetStride(), (const void*)element.offset);
+          if (element.divisor)
+            glVertexAttribDivisor(index, element.divisor);
           index++;
           break;
         }
@@ -119,10 +126,14 @@ namespace ikan {
         case ShaderDataType::Float:
         case ShaderDataType::Float2:
         case ShaderDataType::Float3:
-        case ShaderDataType::Float4: {
+        case ShaderDataType::Float4:
+        case ShaderDataType::Half2:
+        case ShaderDataType::UByte4: {
           glEnableVertexAttribArray(index);
           glVertexAttribPointer(index, (int)element.count, ShaderDataTypeToOpenGLBaseType(element.type),
                                 element.normalized ? GL_TRUE : GL_FALSE, (int)layout.GetStride(), (const void*)element.offset);
+          if (element.divisor)
+            glVertexAttribDivisor(index, element.divisor);
           index++;
           break;
         }
@@ -40,6 +40,7 @@ namespace ikan {
     
   private:
     RendererID renderer_id_ = 0;
+    uint32_t vertex_attribute_index_ = 0;
     std::vector<std::shared_ptr<VertexBuffer>> vertex_buffers_;
     std::shared_ptr<IndexBuffer> index_buffer_;
   };
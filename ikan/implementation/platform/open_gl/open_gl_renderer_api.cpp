@@ -114,5 +114,15 @@ namespace ikan {
     RendererStatistics::Get().draw_calls++;
     pipeline->Unbind();
   }
+  
+  void OpenGLRendererAPI::DrawIndexedInstanced(const std::shared_ptr<Pipeline>& pipeline, uint32_t count, uint32_t instance_count) const {
+    pipeline->Bind();
+    glDrawElementsInstanced(GL_TRIANGLES, (GLsizei)count, GL_UNSIGNED_INT, nullptr, (GLsizei)instance_count);
+    
+    // Unbinding Textures and va
+    glBindTexture(GL_TEXTURE_2D, 0);
+    RendererStatistics::Get().draw_calls++;
+    pipeline->Unbind();
+  }
 
 } // namespace ikan
@@ -80,6 +80,12 @@ namespace ikan {
     ///   - pipeline: pipeline having vertex buffer and index buffer
     ///   - count: number of Indices (if 0 then use index buffer of Vertex array)
     void DrawArrays(const std::shared_ptr<Pipeline>& pipeline, uint32_t count) const override;
+    /// This API draws multiple instances of indexed pipeline
+    /// - Parameters:
+    ///   - pipeline: pipeline having vertex buffers (per vertex and per instance) and index buffer
+    ///   - count: number of Indices of single instance
+    ///   - instance_count: number of instances
+    void DrawIndexedInstanced(const std::shared_ptr<Pipeline>& pipeline, uint32_t count, uint32_t instance_count) const override;
 
     DELETE_COPY_MOVE_CONSTRUCTORS(OpenGLRendererAPI);
   };
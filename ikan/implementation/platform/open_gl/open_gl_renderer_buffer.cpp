@@ -56,6 +56,20 @@ namespace ikan {
     glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
   }
   
+  void OpenGLVertexBuffer::Resize(uint32_t size) {
+    RendererStatistics::Get().vertex_buffer_size -= size_;
+    size_ = size;
+    RendererStatistics::Get().vertex_buffer_size += size_;
+
+    glBindBuffer(GL_ARRAY_BUFFER, renderer_id_);
+    glBufferData(GL_ARRAY_BUFFER, size_, nullptr, GL_DYNAMIC_DRAW);
+    
+    IK_CORE_DEBUG(LogModule::VertexBuffer, "Resizing Open GL Vertex Buffer ...");
+    IK_CORE_DEBUG(LogModule::VertexBuffer, "  Renderer ID       {0}", renderer_id_);
+    IK_CORE_DEBUG(LogModule::VertexBuffer, "  Size              {0} B", size_);
+    IK_CORE_DEBUG(LogModule::VertexBuffer, "  Total Size Used   {0} B", RendererStatistics::Get().vertex_buffer_size);
+  }
+  
   void OpenGLVertexBuffer::Bind() const {
     glBindBuffer(GL_ARRAY_BUFFER, renderer_id_);
   }
@@ -30,6 +30,9 @@ namespace ikan {
     ///   - data: Data pointer to be stored in GPU
     ///   - size: size of data
     void SetData(void* data, uint32_t size) override;
+    /// This function reallocates the dynamic buffer storage with new size. Previous data is discarded
+    /// - Parameter size: new size of buffer
+    void Resize(uint32_t size) override;
     /// This function binds the Vertex Buffer before rendering
     void Bind() const override;
     /// This function unbinds the Vertex Buffer after rendering
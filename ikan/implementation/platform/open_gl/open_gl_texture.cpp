@@ -58,19 +58,18 @@ namespace ikan {
     
   } // namespace texture_utils
   
-  OpenGLTexture::OpenGLTexture(uint32_t width, uint32_t height, void* data, uint32_t size)
+  OpenGLTexture::OpenGLTexture(uint32_t width, uint32_t height, void* data, uint32_t size, bool linear)
   : width_((int32_t)width), height_((int32_t)height),
-  internal_format_(GL_RGBA8), data_format_(GL_RGBA), size_(size) {
-    // Create the buffer to store the white texture
-    texture_data_ = new uint32_t;
-    memcpy(texture_data_, data, size_);
+  internal_format_(GL_RGBA8), data_format_(GL_RGBA), size_(size), linear_(linear) {
+    // User data is uploaded directly (it can be bigger than single pixel, e.g. atlas page)
+    texture_data_ = data;
     
     IDManager::GetTextureId(&renderer_id_);
     glBindTexture(GL_TEXTURE_2D, renderer_id_);
     
     // Setup Texture
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (linear ? GL_LINEAR : GL_NEAREST));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (linear ? GL_LINEAR : GL_NEAREST));
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     
@@ -96,20 +95,18 @@ namespace ikan {
     IK_CORE_DEBUG(LogModule::Texture, "  InternalFormat     {0}  ", texture_utils::GetFormatNameFromEnum(internal_format_));
     IK_CORE_DEBUG(LogModule::Texture, "  DataFormat         {0}  ", texture_utils::GetFormatNameFromEnum(data_format_));
     
-    delete (uint32_t*)texture_data_;
+    texture_data_ = nullptr;
   }
   
   OpenGLTexture::OpenGLTexture(const std::string& file_path, bool linear)
-  : file_path_(file_path), name_(StringUtils::GetNameFromFilePath(file_path)),
-  internal_format_(GL_RGBA8), data_format_(GL_RGBA) {
-    if (renderer_id_)
-      IDManager::RemoveTextureId(&renderer_id_);
-
-    // Invert the texture. as by default open gl load inverted vertically
-    stbi_set_flip_vertically_on_load(1);
-    
-    // Load the file with stb image API
-    texture_data_ = stbi_load(file_path_.c_str(), &width_, &height_, &channel_, 0 /* desired_channels */ );
+  : OpenGLTexture(TextureImage::Decode(file_path), linear) {
+  }
+  
+  OpenGLTexture::OpenGLTexture(const TextureImage& image, bool linear)
+  : width_(image.width), height_(image.height), channel_(image.channels), internal_format_(GL_RGBA8), data_format_(GL_RGBA),
+  file_path_(image.file_path), name_(StringUtils::GetNameFromFilePath(image.file_path)), linear_(linear) {
+    // Pixels are decoded (and owned) by image
+    texture_data_ = image.pixels.get();
     
     // If file loaded successfullt
     if (texture_data_) {
@@ -144,17 +141,30 @@ namespace ikan {
       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
       glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
       
-      // Create texture in the renderer Buffer
-      glTexImage2D(GL_TEXTURE_2D, 0, /* Level */ (GLint)internal_format_, width_, height_,
-                   0, /* Border */ data_format_, texture_utils::GetTextureType(internal_format_), texture_data_);
+      // Create texture in the renderer Buffer. Upload all mip levels stored in image (level 0 first)
+      const uint8_t* level_data = image.pixels.get();
+      int32_t level_width = width_, level_height = height_;
+      for (uint32_t level = 0; level < image.num_levels; level++) {
+        glTexImage2D(GL_TEXTURE_2D, (GLint)level, (GLint)internal_format_, level_width, level_height,
+                     0, /* Border */ data_format_, texture_utils::GetTextureType(internal_format_), level_data);
+        
+        uint32_t level_size = (uint32_t)level_width * (uint32_t)level_height * (uint32_t)channel_;
+        level_data += level_size;
+        size_ += level_size;
+        level_width = std::max(1, level_width / 2);
+        level_height = std::max(1, level_height / 2);
+      }
       
-      size_ = (uint32_t)width_ * (uint32_t)height_ * (uint32_t)channel_;
+      if (image.num_levels > 1) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)image.num_levels - 1);
+      }
       
       // Increment the size in stats
       RendererStatistics::Get().texture_buffer_size += size_;
       
-      // Delete the data as we have already loaded in graphics
-      delete (stbi_uc*)texture_data_;
+      // Data is already loaded in graphics
+      texture_data_ = nullptr;
     }
     
     if (uploaded_) {
@@ -230,6 +240,29 @@ namespace ikan {
     RendererStatistics::Get().texture_buffer_size += data_size_;
   }
   
+  OpenGLCharTexture::OpenGLCharTexture(const glm::ivec2& size, const void* data)
+  : size_(size), bearing_(0, 0), width_((uint32_t)size.x), height_((uint32_t)size.y) {
+    IDManager::GetTextureId(&renderer_id_);
+    
+    glBindTexture(GL_TEXTURE_2D, renderer_id_);
+    
+    // Create texture in the renderer Buffer
+    glTexImage2D(GL_TEXTURE_2D, 0, /* Level */ GL_RED, (GLsizei)width_, (GLsizei)height_, 0, /* Border */ GL_RED,
+                 texture_utils::GetTextureType(GL_RED), data);
+    
+    // set texture options
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    
+    IK_CORE_TRACE(LogModule::CharTexture, "Creating Open GL Glyph Atlas Texture {0} x {1} ( Renderer ID {2} )", width_, height_, renderer_id_);
+    
+    // Increment the size in stats
+    data_size_ = width_ * height_;
+    RendererStatistics::Get().texture_buffer_size += data_size_;
+  }
+  
   /// Open GL Texture Destructor
   OpenGLCharTexture::~OpenGLCharTexture() {
     IDManager::RemoveTextureId(&renderer_id_);
@@ -243,5 +276,10 @@ namespace ikan {
   void OpenGLCharTexture::Unbind() const {
     glBindTexture(GL_TEXTURE_2D, 0);
   }
+  void OpenGLCharTexture::SetSubData(const glm::ivec2& offset, const glm::ivec2& size, const void* data) {
+    IK_CORE_ASSERT(offset.x + size.x <= (int32_t)width_ and offset.y + size.y <= (int32_t)height_, "Region is out of texture");
+    glBindTexture(GL_TEXTURE_2D, renderer_id_);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, size.x, size.y, GL_RED, texture_utils::GetTextureType(GL_RED), data);
+  }
 
 } // namespace ikan
@@ -21,12 +21,18 @@ namespace ikan {
     ///   - height: height of texture
     ///   - data: user data to fill in texture
     ///   - size: size of texture
-    OpenGLTexture(uint32_t width, uint32_t height, void* data, uint32_t size);
+    ///   - linear: min linear filter
+    OpenGLTexture(uint32_t width, uint32_t height, void* data, uint32_t size, bool linear = true);
     /// This constructor creates the texture using image file path
     /// - Parameters:
     ///   - file_path: Texture image file path (absolute)
     ///   - linear: min linear filter
     OpenGLTexture(const std::string& file_path, bool linear);
+    /// This constructor creates the texture using decoded image
+    /// - Parameters:
+    ///   - image: decoded image
+    ///   - linear: min linear filter
+    OpenGLTexture(const TextureImage& image, bool linear);
 
     /// Default destructor that delete the texture
     virtual ~OpenGLTexture();
@@ -41,12 +47,16 @@ namespace ikan {
     uint32_t GetWidth() const override { return width_; }
     /// This function returns height of texture
     uint32_t GetHeight() const override { return height_; }
+    /// This function returns size of texture in bytes
+    uint32_t GetSize() const override { return size_; }
     /// This function returns renderer ID of texture
     RendererID GetRendererID() const override { return renderer_id_; }
     /// This function returns file path of texture
     const std::string& GetfilePath() const override { return file_path_; }
     /// This function returns name of texture
     const std::string& GetName() const override { return name_; }
+    /// This function returns true if texture uses linear filter
+    bool IsLinear() const override { return linear_; }
 
   private:
     RendererID renderer_id_ = 0;
@@ -60,6 +70,7 @@ namespace ikan {
     
     void* texture_data_;
     std::string file_path_ = "", name_ = "";
+    bool linear_ = true;
   };
   
   /// Implementaiton for Open GL Char Texture
@@ -73,6 +84,11 @@ namespace ikan {
     ///   - advance: advance
     ///   - char_val: character value
     OpenGLCharTexture(const FT_Face& face, const glm::ivec2& size, const glm::ivec2& bearing, uint32_t advance, [[maybe_unused]] char char_val);
+    /// This constructor creates the Open GL Texture for glyph atlas page
+    /// - Parameters:
+    ///   - size: size of page
+    ///   - data: single channel pixels of page
+    OpenGLCharTexture(const glm::ivec2& size, const void* data);
     /// This is the default Open GL Char Texture destructor
     virtual ~OpenGLCharTexture();
     
@@ -80,6 +96,12 @@ namespace ikan {
     void Bind(uint32_t slot) const override;
     /// This function unbinds the texture
     void Unbind() const  override;
+    /// This function updates the pixels of a region of texture
+    /// - Parameters:
+    ///   - offset: offset of region
+    ///   - size: size of region
+    ///   - data: single channel pixels of region
+    void SetSubData(const glm::ivec2& offset, const glm::ivec2& size, const void* data) override;
     
     /// This function returns the Renderer ID
     RendererID GetRendererID() const override { return renderer_id_; }
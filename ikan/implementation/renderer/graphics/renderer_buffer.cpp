@@ -61,6 +61,8 @@ namespace ikan {
       case ShaderDataType::Int3   : return 4 * 3;
       case ShaderDataType::Int4   : return 4 * 4;
       case ShaderDataType::Bool   : return 1;
+      case ShaderDataType::Half2  : return 2 * 2;
+      case ShaderDataType::UByte4 : return 1 * 4;
     }
     IK_CORE_ASSERT(false, "Invalid Type");
     return 0;
@@ -82,12 +84,15 @@ namespace ikan {
       case ShaderDataType::Int3   : return 3;
       case ShaderDataType::Int4   : return 4;
       case ShaderDataType::Bool   : return 1;
+      case ShaderDataType::Half2  : return 2;
+      case ShaderDataType::UByte4 : return 4;
     }
     IK_CORE_ASSERT(false, "Unkown Shader datatype!! ");
   }
   
-  BufferElement::BufferElement(const std::string& name, ShaderDataType type, bool normalized)
-  : name(name), type(type), size(ShaderDataTypeSize(type)), count(GetElementCount(type)), offset(0), normalized(normalized) { }
+  BufferElement::BufferElement(const std::string& name, ShaderDataType type, bool normalized, uint32_t divisor)
+  : name(name), type(type), size(ShaderDataTypeSize(type)), count(GetElementCount(type)), offset(0), normalized(normalized),
+  divisor(divisor) { }
 
   BufferLayout::BufferLayout(const std::initializer_list<BufferElement>& elements)
   : elements_(elements) {
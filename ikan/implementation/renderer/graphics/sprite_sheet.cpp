@@ -0,0 +1,47 @@
+//
+//  sprite_sheet.cpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "sprite_sheet.hpp"
+
+namespace ikan {
+
+  std::shared_ptr<SpriteSheet> SpriteSheet::Create(const std::shared_ptr<Texture>& texture, const glm::vec2& cell_size) {
+    return std::make_shared<SpriteSheet>(texture, cell_size);
+  }
+
+  SpriteSheet::SpriteSheet(const std::shared_ptr<Texture>& texture, const glm::vec2& cell_size)
+  : texture_(texture), texture_handle_(texture), cell_size_(cell_size) {
+    IK_CORE_ASSERT(texture_, "Invalid texture of sprite sheet");
+  }
+
+  SpriteSheet::FrameID SpriteSheet::AddFrame(const glm::vec2& coords, const glm::vec2& sprite_size) {
+    IK_CORE_ASSERT(frame_uvs_.size() < std::numeric_limits<FrameID>::max(), "Too many frames in sprite sheet");
+
+    // Same UVs as SubTexture::CreateFromCoords
+    const glm::vec2 texture_size = { (float)texture_->GetWidth(), (float)texture_->GetHeight() };
+    const glm::vec2 min = (coords * cell_size_) / texture_size;
+    const glm::vec2 max = ((coords + sprite_size) * cell_size_) / texture_size;
+    frame_uvs_.emplace_back(min, max);
+    return (FrameID)(frame_uvs_.size() - 1);
+  }
+
+  SpriteSheet::ClipID SpriteSheet::AddClip(const std::vector<Frame>& frames) {
+    FrameID first_frame = (FrameID)frame_uvs_.size();
+    for (const auto& frame : frames)
+      AddFrame(frame.coords, frame.sprite_size);
+    return AddClip(first_frame, (uint16_t)frames.size());
+  }
+
+  SpriteSheet::ClipID SpriteSheet::AddClip(FrameID first_frame, uint16_t num_frames) {
+    IK_CORE_ASSERT(num_frames > 0 and first_frame + num_frames <= frame_uvs_.size(), "Invalid frames of clip");
+    IK_CORE_ASSERT(clips_.size() < std::numeric_limits<ClipID>::max(), "Too many clips in sprite sheet");
+
+    clips_.push_back({ first_frame, num_frames });
+    return (ClipID)(clips_.size() - 1);
+  }
+
+} // namespace ikan
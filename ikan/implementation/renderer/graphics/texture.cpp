@@ -7,12 +7,244 @@
 
 #include "texture.hpp"
 #include "platform/open_gl/open_gl_texture.hpp"
+#include "renderer/utils/renderer_stats.hpp"
+
+#include <stb_image.h>
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 namespace ikan {
   
-  std::shared_ptr<Texture> Texture::Create(uint32_t width, uint32_t height, void* data, uint32_t size) {
+  /// Header of decoded texture cache file '.iktex'. Followed by RGBA8 pixels of all mip levels
+  ///   - Cache is keyed on size and modification time of image file, so that cache hit does not read the image file
+  struct TextureCacheHeader {
+    static constexpr uint32_t Magic = 0x58544B49; // "IKTX"
+    static constexpr uint32_t Version = 2;
+    static constexpr uint32_t FormatRGBA8 = 1;
+    
+    uint32_t magic = Magic;
+    uint32_t version = Version;
+    uint64_t source_size = 0;
+    int64_t source_mtime = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t format = FormatRGBA8;
+    uint32_t num_levels = 1;
+  };
+  static constexpr int32_t TextureCacheChannels = 4;
+  static std::atomic<bool> cache_mip_levels_ = false;
+  
+  /// Size and modification time of image file. Key of texture cache
+  struct TextureSourceKey {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+  };
+  
+  /// This function returns the size and modification time of image file. Returns false if file does not exist
+  /// - Parameters:
+  ///   - file_path: path of image file
+  ///   - key: size and modification time (output)
+  static bool GetTextureSourceKey(const std::string& file_path, TextureSourceKey& key) {
+    std::error_code error;
+    key.size = (uint64_t)std::filesystem::file_size(file_path, error);
+    if (error)
+      return false;
+    key.mtime = (int64_t)std::filesystem::last_write_time(file_path, error).time_since_epoch().count();
+    return !error;
+  }
+  
+  /// This function returns the number of levels in full mip chain (till 1x1)
+  /// - Parameters:
+  ///   - width: width of level 0
+  ///   - height: height of level 0
+  static uint32_t GetNumMipLevels(uint32_t width, uint32_t height) {
+    uint32_t num_levels = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size /= 2)
+      num_levels++;
+    return num_levels;
+  }
+  
+  /// This function returns the number of bytes of all the mip levels of RGBA8 image
+  /// - Parameters:
+  ///   - width: width of level 0
+  ///   - height: height of level 0
+  ///   - num_levels: number of mip levels
+  static size_t GetMipChainBytes(uint32_t width, uint32_t height, uint32_t num_levels) {
+    size_t bytes = 0;
+    for (uint32_t level = 0; level < num_levels; level++) {
+      bytes += (size_t)width * height * TextureCacheChannels;
+      width = std::max(1u, width / 2);
+      height = std::max(1u, height / 2);
+    }
+    return bytes;
+  }
+  
+  /// This function maps the texture cache file. Returns false if cache is missing or stale
+  /// - Parameters:
+  ///   - cache_path: path of cache file
+  ///   - source_key: size and modification time of image file
+  ///   - mip_levels: flag to expect full mip chain in cache
+  ///   - image: image pointing to mapped pixels (output)
+  static bool MapTextureCache(const std::string& cache_path, const TextureSourceKey& source_key, bool mip_levels, TextureImage& image) {
+    int32_t fd = open(cache_path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    
+    struct stat file_stat;
+    void* mapping = MAP_FAILED;
+    if (fstat(fd, &file_stat) == 0 and (size_t)file_stat.st_size > sizeof(TextureCacheHeader))
+      mapping = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Mapping is valid after closing the file
+    close(fd);
+    
+    if (mapping == MAP_FAILED)
+      return false;
+    
+    size_t mapping_size = (size_t)file_stat.st_size;
+    TextureCacheHeader header;
+    memcpy(&header, mapping, sizeof(TextureCacheHeader));
+    uint32_t expected_levels = mip_levels ? GetNumMipLevels(header.width, header.height) : 1;
+    if (header.magic != TextureCacheHeader::Magic or header.version != TextureCacheHeader::Version or
+        header.source_size != source_key.size or header.source_mtime != source_key.mtime or header.format != TextureCacheHeader::FormatRGBA8 or header.num_levels != expected_levels or
+        mapping_size != sizeof(TextureCacheHeader) + GetMipChainBytes(header.width, header.height, header.num_levels)) {
+      munmap(mapping, mapping_size);
+      return false;
+    }
+    
+    image.width = (int32_t)header.width;
+    image.height = (int32_t)header.height;
+    image.channels = TextureCacheChannels;
+    image.num_levels = header.num_levels;
+    image.from_cache = true;
+    image.pixels = std::shared_ptr<uint8_t>((uint8_t*)mapping + sizeof(TextureCacheHeader), [mapping, mapping_size](uint8_t*) {
+      munmap(mapping, mapping_size);
+    });
+    return true;
+  }
+  
+  /// This function writes the texture cache file. Written in temporary file first, so that other thread never maps partial file
+  /// - Parameters:
+  ///   - cache_path: path of cache file
+  ///   - source_key: size and modification time of image file
+  ///   - image: decoded RGBA8 image
+  static void SaveTextureCache(const std::string& cache_path, const TextureSourceKey& source_key, const TextureImage& image) {
+    std::string temp_path = cache_path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+      std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+      if (!file) {
+        IK_CORE_WARN(LogModule::Texture, "Can not write the Texture cache '{0}'", cache_path.c_str());
+        return;
+      }
+      
+      TextureCacheHeader header;
+      header.source_size = source_key.size;
+      header.source_mtime = source_key.mtime;
+      header.width = (uint32_t)image.width;
+      header.height = (uint32_t)image.height;
+      header.num_levels = image.num_levels;
+      file.write((const char*)&header, sizeof(TextureCacheHeader));
+      file.write((const char*)image.pixels.get(), (std::streamsize)GetMipChainBytes(header.width, header.height, header.num_levels));
+    }
+    std::rename(temp_path.c_str(), cache_path.c_str());
+  }
+  
+  /// This function creates the mip chain of RGBA8 image with 2x2 box filter
+  /// - Parameters:
+  ///   - pixels: pixels of level 0
+  ///   - width: width of level 0
+  ///   - height: height of level 0
+  ///   - num_levels: number of mip levels (output)
+  static std::shared_ptr<uint8_t> CreateMipChain(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t& num_levels) {
+    num_levels = GetNumMipLevels(width, height);
+    size_t bytes = GetMipChainBytes(width, height, num_levels);
+    std::shared_ptr<uint8_t> mip_chain(new uint8_t[bytes], std::default_delete<uint8_t[]>());
+    memcpy(mip_chain.get(), pixels, (size_t)width * height * TextureCacheChannels);
+    
+    const uint8_t* src = mip_chain.get();
+    uint8_t* dst = mip_chain.get() + (size_t)width * height * TextureCacheChannels;
+    for (uint32_t level = 1; level < num_levels; level++) {
+      uint32_t dst_width = std::max(1u, width / 2), dst_height = std::max(1u, height / 2);
+      for (uint32_t y = 0; y < dst_height; y++) {
+        uint32_t y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+        for (uint32_t x = 0; x < dst_width; x++) {
+          uint32_t x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+          for (int32_t c = 0; c < TextureCacheChannels; c++) {
+            uint32_t sum = src[(y0 * width + x0) * TextureCacheChannels + c] + src[(y0 * width + x1) * TextureCacheChannels + c] +
+                           src[(y1 * width + x0) * TextureCacheChannels + c] + src[(y1 * width + x1) * TextureCacheChannels + c];
+            dst[(y * dst_width + x) * TextureCacheChannels + c] = (uint8_t)((sum + 2) / 4);
+          }
+        }
+      }
+      src = dst;
+      dst += (size_t)dst_width * dst_height * TextureCacheChannels;
+      width = dst_width;
+      height = dst_height;
+    }
+    return mip_chain;
+  }
+  
+  TextureImage TextureImage::Decode(const std::string& file_path) {
+    TextureImage image;
+    image.file_path = file_path;
+    
+    // Map the decoded pixels from cache if image is not changed (same size and modification time). Image file is not read on hit
+    TextureSourceKey source_key;
+    if (!GetTextureSourceKey(file_path, source_key))
+      return image;
+    bool mip_levels = cache_mip_levels_;
+    std::string cache_path = DM::CacheFile(file_path, ".iktex");
+    if (MapTextureCache(cache_path, source_key, mip_levels, image))
+      return image;
+    
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file)
+      return image;
+    std::vector<uint8_t> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    
+    // Invert the texture. as by default open gl load inverted vertically. Thread local flag, as may decode on worker thread
+    stbi_set_flip_vertically_on_load_thread(1);
+    
+    // Load the file with stb image API. Channels are normalized to RGBA
+    stbi_uc* pixels = stbi_load_from_memory(content.data(), (int32_t)content.size(), &image.width, &image.height, &image.channels,
+                                            TextureCacheChannels);
+    if (!pixels)
+      return image;
+    
+    image.channels = TextureCacheChannels;
+    if (mip_levels) {
+      image.pixels = CreateMipChain(pixels, (uint32_t)image.width, (uint32_t)image.height, image.num_levels);
+      stbi_image_free(pixels);
+    } else {
+      image.pixels = std::shared_ptr<uint8_t>(pixels, stbi_image_free);
+    }
+    
+    SaveTextureCache(cache_path, source_key, image);
+    return image;
+  }
+  
+  void TextureImage::SetCacheMipLevels(bool enable) { cache_mip_levels_ = enable; }
+
+  TextureHandle::TextureHandle(const std::shared_ptr<Texture>& texture) : TextureHandle(TextureLibrary::GetHandle(texture)) { }
+  Texture* TextureHandle::Get() const { return TextureLibrary::Resolve(*this); }
+  std::shared_ptr<Texture> TextureHandle::GetShared() const {
+    Texture* texture = Get();
+    return texture ? texture->shared_from_this() : nullptr;
+  }
+  void TextureHandle::MarkInUse() const { TextureLibrary::MarkInUse(*this); }
+  
+  Texture::~Texture() {
+    TextureLibrary::ReleaseHandle(this);
+  }
+
+  std::shared_ptr<Texture> Texture::Create(uint32_t width, uint32_t height, void* data, uint32_t size, bool linear) {
     switch (Renderer::GetApi()) {
-      case Renderer::Api::OpenGl: return std::make_shared<OpenGLTexture>(width, height, data, size);
+      case Renderer::Api::OpenGl: return std::make_shared<OpenGLTexture>(width, height, data, size, linear);
       case Renderer::Api::None:
       default:
         IK_CORE_ASSERT(false, "Invalid Renderer API (None)"); break;
@@ -28,13 +260,22 @@ namespace ikan {
     }
   }
   
+  std::shared_ptr<Texture> Texture::Create(const TextureImage& image, bool linear) {
+    switch (Renderer::GetApi()) {
+      case Renderer::Api::OpenGl: return std::make_shared<OpenGLTexture>(image, linear);
+      case Renderer::Api::None:
+      default:
+        IK_CORE_ASSERT(false, "Invalid Renderer API (None)"); break;
+    }
+  }
+  
   SubTexture::SubTexture(const std::shared_ptr<Texture>& sprite_image,
                          const glm::vec2& min,
                          const glm::vec2& max,
                          const glm::vec2& coords,
                          const glm::vec2& sprite_size,
                          const glm::vec2& cell_size)
-  : sprite_image_(sprite_image), sprite_size_(sprite_size), cell_size_(cell_size), coords_(coords) {
+  : sprite_image_(sprite_image), sprite_handle_(sprite_image), sprite_size_(sprite_size), cell_size_(cell_size), coords_(coords) {
     texture_coord_[0] = {min.x, min.y};
     texture_coord_[1] = {max.x, min.y};
     texture_coord_[2] = {max.x, max.y};
@@ -66,6 +307,7 @@ namespace ikan {
   }
   
   std::shared_ptr<Texture> SubTexture::GetSpriteImage() { return sprite_image_; }
+  TextureHandle SubTexture::GetSpriteHandle() const { return sprite_handle_; }
   const glm::vec2* SubTexture::GetTexCoord() const { return texture_coord_; }
   glm::vec2& SubTexture::GetSpriteSize() { return sprite_size_; }
   glm::vec2& SubTexture::GetCellSize() { return cell_size_; }
@@ -80,27 +322,414 @@ namespace ikan {
         IK_CORE_ASSERT(false, "Invalid Renderer API (None)"); break;
     }
   }
+  std::shared_ptr<CharTexture> CharTexture::Create(const glm::ivec2& size, const void* data) {
+    switch (Renderer::GetApi()) {
+      case Renderer::Api::OpenGl: return std::make_shared<OpenGLCharTexture>(size, data);
+      case Renderer::Api::None:
+      default:
+        IK_CORE_ASSERT(false, "Invalid Renderer API (None)"); break;
+    }
+  }
+
+  // Handle table is defined before any static storing the textures, so that it is destroyed after them
+  std::vector<TextureLibrary::HandleSlot> TextureLibrary::handle_slots_;
+  std::vector<uint32_t> TextureLibrary::free_handle_slots_;
+  std::unordered_map<const Texture*, uint32_t> TextureLibrary::texture_handles_;
 
-  std::unordered_map<std::string, std::array<std::shared_ptr<Texture>, 2>> TextureLibrary::texture_library_;
+  /// Texture handle returned by GetTextureAsync(). Forwards to placeholder texture till the decoded image is uploaded
+  class AsyncTexture : public Texture {
+  public:
+    AsyncTexture(const std::string& file_path, bool linear, const std::shared_ptr<Texture>& placeholder)
+    : file_path_(file_path), name_(StringUtils::GetNameFromFilePath(file_path)), linear_(linear), texture_(placeholder) { }
+    
+    void Bind(uint32_t slot = 0) const override { texture_->Bind(slot); }
+    void Unbind() const override { texture_->Unbind(); }
+    
+    RendererID GetRendererID() const override { return texture_->GetRendererID(); }
+    uint32_t GetWidth() const override { return texture_->GetWidth(); }
+    uint32_t GetHeight() const override { return texture_->GetHeight(); }
+    uint32_t GetSize() const override { return texture_->GetSize(); }
+    const std::string& GetfilePath() const override { return file_path_; }
+    const std::string& GetName() const override { return name_; }
+    bool IsLinear() const override { return linear_; }
+    
+    /// This function replaces the placeholder with uploaded texture
+    /// - Parameter texture: uploaded texture
+    void SetTexture(const std::shared_ptr<Texture>& texture) { texture_ = texture; }
+    
+  private:
+    std::string file_path_, name_;
+    bool linear_ = true;
+    std::shared_ptr<Texture> texture_;
+  };
+  
+  /// Images decoded by worker threads, waiting for upload on renderer thread
+  ///   - Decoded image keeps only weak reference of async texture. If library drops the texture while decoding (ResetTextures() or
+  ///     eviction), texture is destroyed on renderer thread, as handle table and Open GL textures are not thread safe
+  struct AsyncTextureData {
+    struct DecodedImage {
+      std::weak_ptr<AsyncTexture> texture;
+      TextureImage image;
+      bool linear = true;
+    };
+    
+    std::mutex mutex;
+    std::vector<DecodedImage> decoded_images;
+    std::shared_ptr<Texture> placeholder;
+  };
+  static AsyncTextureData async_data_;
+
+  std::unordered_map<std::string, std::array<TextureLibrary::TextureEntry, 2>> TextureLibrary::texture_library_;
+  size_t TextureLibrary::budget_ = TextureLibrary::DefaultBudget;
+  uint64_t TextureLibrary::frame_ = 0;
   
   std::shared_ptr<Texture> TextureLibrary::GetTexture(const std::string& path, bool linear) {
-    if (texture_library_.find(path) == texture_library_.end() or !texture_library_[path][linear]) {
-      texture_library_[path][linear] = Texture::Create(path, linear);
+    auto& entry = texture_library_[path][linear];
+    if (!entry.texture) {
+      entry.texture = Texture::Create(path, linear);
+      UpdateHandle(entry, path, linear);
       IK_CORE_DEBUG(LogModule::Texture, "Adding Texture '{0}' to Shdaer Library", StringUtils::GetNameFromFilePath(path));
       IK_CORE_DEBUG(LogModule::Texture, "Number of Textures loaded yet {0}", texture_library_.size());
     } else {
       IK_CORE_DEBUG(LogModule::Texture, "Returning Pre loaded Texture '{0}' from Shdaer Library", StringUtils::GetNameFromFilePath(path));
     }
     
-    return texture_library_.at(path)[linear];
+    entry.num_requests++;
+    entry.last_used_frame = frame_;
+    return entry.texture;
+  }
+  
+  std::shared_ptr<Texture> TextureLibrary::GetTextureAsync(const std::string& path, bool linear) {
+    auto& entry = texture_library_[path][linear];
+    entry.num_requests++;
+    entry.last_used_frame = frame_;
+    if (entry.texture)
+      return entry.texture;
+    
+    if (!async_data_.placeholder) {
+      static uint32_t transparent_pixel = 0x00000000;
+      async_data_.placeholder = Texture::Create(1, 1, &transparent_pixel, sizeof(uint32_t));
+    }
+    
+    std::shared_ptr<AsyncTexture> async_texture = std::make_shared<AsyncTexture>(path, linear, async_data_.placeholder);
+    entry.texture = async_texture;
+    UpdateHandle(entry, path, linear);
+    IK_CORE_DEBUG(LogModule::Texture, "Decoding Texture '{0}' asynchronously", StringUtils::GetNameFromFilePath(path));
+    
+    // Decode on worker thread. Upload in Update() on renderer thread. Worker does not own the texture (see AsyncTextureData)
+    const std::string file_path = path;
+    const std::weak_ptr<AsyncTexture> weak_texture = async_texture;
+    dispatch_async(loop_dispactch_queue_, ^{
+      TextureImage image = TextureImage::Decode(file_path);
+      std::scoped_lock lock(async_data_.mutex);
+      async_data_.decoded_images.push_back({weak_texture, std::move(image), linear});
+    });
+    
+    return entry.texture;
+  }
+  
+  void TextureLibrary::PreloadTextures(const std::vector<std::pair<std::string, bool>>& textures) {
+    // Collect the textures not loaded yet (unique)
+    std::vector<std::pair<std::string, bool>> textures_to_load;
+    for (const auto& [path, linear] : textures) {
+      if (texture_library_.find(path) != texture_library_.end() and texture_library_[path][linear].texture)
+        continue;
+      if (std::find(textures_to_load.begin(), textures_to_load.end(), std::make_pair(path, linear)) != textures_to_load.end())
+        continue;
+      textures_to_load.emplace_back(path, linear);
+    }
+    
+    RETURN_IF(textures_to_load.empty());
+    auto start_time = std::chrono::high_resolution_clock::now();
+    
+    // Each image file is decoded once, even if it is needed with both linear and nearest filter
+    std::vector<std::string> paths_to_decode;
+    std::vector<size_t> image_indices(textures_to_load.size());
+    for (size_t i = 0; i < textures_to_load.size(); i++) {
+      auto it = std::find(paths_to_decode.begin(), paths_to_decode.end(), textures_to_load[i].first);
+      image_indices[i] = (size_t)(it - paths_to_decode.begin());
+      if (it == paths_to_decode.end())
+        paths_to_decode.push_back(textures_to_load[i].first);
+    }
+    
+    // Decode all the images in parallel
+    std::vector<TextureImage> images(paths_to_decode.size());
+    TextureImage* images_data = images.data();
+    const std::string* paths_data = paths_to_decode.data();
+    dispatch_apply(paths_to_decode.size(), loop_dispactch_queue_, ^(size_t i) {
+      images_data[i] = TextureImage::Decode(paths_data[i]);
+    });
+    
+    uint32_t num_from_cache = 0;
+    for (const auto& image : images)
+      num_from_cache += image.from_cache;
+    auto decode_time = std::chrono::high_resolution_clock::now();
+    
+    // Upload in order on renderer thread. Failed images are left to GetTexture() to report
+    for (size_t i = 0; i < textures_to_load.size(); i++) {
+      const auto& [path, linear] = textures_to_load[i];
+      const TextureImage& image = images[image_indices[i]];
+      if (!image.pixels) {
+        IK_CORE_WARN(LogModule::Texture, "Failed to decode Texture '{0}' ", path);
+        continue;
+      }
+      auto& entry = texture_library_[path][linear];
+      entry.texture = Texture::Create(image, linear);
+      entry.last_used_frame = frame_;
+      UpdateHandle(entry, path, linear);
+    }
+    
+    auto end_time = std::chrono::high_resolution_clock::now();
+    IK_CORE_INFO(LogModule::Texture, "Preloaded {0} Textures in {1} ms", textures_to_load.size(),
+                 std::chrono::duration<float, std::milli>(end_time - start_time).count());
+    IK_CORE_INFO(LogModule::Texture, "  Images              {0} ({1} Warm from cache, {2} Cold)", images.size(), num_from_cache,
+                 images.size() - num_from_cache);
+    IK_CORE_INFO(LogModule::Texture, "  Decode Time         {0} ms", std::chrono::duration<float, std::milli>(decode_time - start_time).count());
+    IK_CORE_INFO(LogModule::Texture, "  Upload Time         {0} ms", std::chrono::duration<float, std::milli>(end_time - decode_time).count());
+  }
+  
+  /// This function uploads the images decoded by worker threads in their async texture handle
+  static void UploadAsyncTextures() {
+    std::vector<AsyncTextureData::DecodedImage> decoded_images;
+    {
+      std::scoped_lock lock(async_data_.mutex);
+      RETURN_IF(async_data_.decoded_images.empty());
+      decoded_images.swap(async_data_.decoded_images);
+    }
+    
+    for (auto& decoded : decoded_images) {
+      // Texture is dropped from library while decoding
+      std::shared_ptr<AsyncTexture> texture = decoded.texture.lock();
+      if (!texture)
+        continue;
+      
+      if (!decoded.image.pixels) {
+        IK_CORE_WARN(LogModule::Texture, "Failed to decode Texture '{0}' ", decoded.image.file_path);
+        continue;
+      }
+      texture->SetTexture(Texture::Create(decoded.image, decoded.linear));
+      IK_CORE_DEBUG(LogModule::Texture, "Uploaded asynchronously decoded Texture '{0}'", texture->GetName());
+    }
+  }
+  
+  void TextureLibrary::Update() {
+    frame_++;
+    UploadAsyncTextures();
+    
+    // Textures referenced outside library or drawn in last few frames are in use. Others are candidates for eviction
+    struct EvictionCandidate {
+      TextureEntry* entry;
+      const std::string* path;
+    };
+    std::vector<EvictionCandidate> candidates;
+    size_t resident_bytes = 0;
+    for (auto& [path, entries] : texture_library_) {
+      for (auto& entry : entries) {
+        if (!entry.texture)
+          continue;
+        
+        resident_bytes += entry.texture->GetSize();
+        entry.last_used_frame = std::max(entry.last_used_frame, handle_slots_[entry.handle.GetIndex()].last_used_frame);
+        if (IsInUse(entry))
+          entry.last_used_frame = frame_;
+        else
+          candidates.push_back({&entry, &path});
+      }
+    }
+    
+    RETURN_IF(resident_bytes <= budget_ or candidates.empty());
+    
+    // Evict least recently used textures till library is in budget. Entry (and its handle) is kept to load the texture again
+    std::sort(candidates.begin(), candidates.end(), [](const EvictionCandidate& a, const EvictionCandidate& b) {
+      return a.entry->last_used_frame < b.entry->last_used_frame;
+    });
+    for (const auto& candidate : candidates) {
+      if (resident_bytes <= budget_)
+        break;
+      
+      resident_bytes -= candidate.entry->texture->GetSize();
+      IK_CORE_DEBUG(LogModule::Texture, "Evicting Texture '{0}' from Shdaer Library (Last used frame {1})",
+                    StringUtils::GetNameFromFilePath(*candidate.path), candidate.entry->last_used_frame);
+      candidate.entry->texture.reset();
+    }
+  }
+  
+  void TextureLibrary::SetBudget(size_t bytes) {
+    budget_ = bytes;
+  }
+  
+  void TextureLibrary::RenderGui(bool* is_open) {
+    CHECK_WIDGET_FLAG(is_open);
+    
+    // Sort the resident textures by size
+    struct ResidentTexture {
+      const std::string* path;
+      const TextureEntry* entry;
+      bool linear;
+    };
+    std::vector<ResidentTexture> textures;
+    size_t resident_bytes = 0;
+    for (const auto& [path, entries] : texture_library_) {
+      for (int32_t i = 0; i < 2; i++) {
+        if (!entries[i].texture)
+          continue;
+        textures.push_back({&path, &entries[i], (bool)i});
+        resident_bytes += entries[i].texture->GetSize();
+      }
+    }
+    std::sort(textures.begin(), textures.end(), [](const ResidentTexture& a, const ResidentTexture& b) {
+      return a.entry->texture->GetSize() > b.entry->texture->GetSize();
+    });
+    
+    ImGui::Begin("Texture Library", is_open);
+    ImGui::Text("Resident %.2f / %.2f MB in %d Textures", (float)resident_bytes / (1024.0f * 1024.0f),
+                (float)budget_ / (1024.0f * 1024.0f), (int32_t)textures.size());
+    ImGui::Text("All Textures %.2f MB", (float)RendererStatistics::Get().texture_buffer_size / (1024.0f * 1024.0f));
+    PropertyGrid::HoveredMsg("Total texture memory (including textures not owned by library)");
+    ImGui::Separator();
+    
+    ImGui::Columns(6);
+    ImGui::Text("Name"); ImGui::NextColumn();
+    ImGui::Text("Filter"); ImGui::NextColumn();
+    ImGui::Text("Size (KB)"); ImGui::NextColumn();
+    ImGui::Text("In Use"); ImGui::NextColumn();
+    ImGui::Text("Requests"); ImGui::NextColumn();
+    ImGui::Text("Last Used"); ImGui::NextColumn();
+    ImGui::Separator();
+    
+    for (const auto& resident : textures) {
+      ImGui::Text("%s", resident.entry->texture->GetName().c_str());
+      PropertyGrid::HoveredMsg(resident.path->c_str());
+      ImGui::NextColumn();
+      ImGui::Text("%s", resident.linear ? "Linear" : "Nearest");
+      ImGui::NextColumn();
+      ImGui::Text("%.1f", (float)resident.entry->texture->GetSize() / 1024.0f);
+      ImGui::NextColumn();
+      ImGui::Text("%s", IsInUse(*resident.entry) ? "Yes" : "No");
+      PropertyGrid::HoveredMsg("Referenced outside library or drawn in last few frames. Texture in use is never evicted");
+      ImGui::NextColumn();
+      ImGui::Text("%d", resident.entry->num_requests);
+      ImGui::NextColumn();
+      ImGui::Text("%llu", (unsigned long long)(frame_ - resident.entry->last_used_frame));
+      PropertyGrid::HoveredMsg("Frames since last used");
+      ImGui::NextColumn();
+    }
+    
+    ImGui::Columns(1);
+    ImGui::End();
   }
   
   void TextureLibrary::ResetTextures() {
     for (auto it = texture_library_.begin(); it != texture_library_.end(); it++) {
       IK_CORE_TRACE(LogModule::Texture, "Removing Texture '{0}' from Shdaer Library", StringUtils::GetNameFromFilePath(it->first));
       for (int i = 0; i < 2; i++)
-        it->second[i].reset();
+        it->second[i] = TextureEntry();
+    }
+    
+    // Handles of library textures get stale
+    for (uint32_t index = 0; index < handle_slots_.size(); index++) {
+      if (!handle_slots_[index].path.empty())
+        FreeHandleSlot(index);
+    }
+    
+    std::scoped_lock lock(async_data_.mutex);
+    async_data_.decoded_images.clear();
+    async_data_.placeholder.reset();
+  }
+  
+  bool TextureLibrary::IsInUse(const TextureEntry& entry) {
+    if (entry.texture.use_count() > 1)
+      return true;
+    return entry.handle.value_ and frame_ - handle_slots_[entry.handle.GetIndex()].last_used_frame <= PinnedFrames;
+  }
+  
+  TextureHandle TextureLibrary::GetHandle(const std::shared_ptr<Texture>& texture) {
+    if (!texture)
+      return TextureHandle();
+    
+    auto it = texture_handles_.find(texture.get());
+    if (it != texture_handles_.end())
+      return TextureHandle(it->second, handle_slots_[it->second].generation);
+    
+    uint32_t index = AllocateHandleSlot();
+    handle_slots_[index].texture = texture.get();
+    texture_handles_[texture.get()] = index;
+    return TextureHandle(index, handle_slots_[index].generation);
+  }
+  
+  Texture* TextureLibrary::Resolve(TextureHandle handle) {
+    uint32_t index = handle.GetIndex();
+    if (handle.value_ == 0 or index >= handle_slots_.size() or handle_slots_[index].generation != handle.GetGeneration())
+      return nullptr;
+    
+    // Load the evicted library texture again without blocking the render loop. Async texture is stored in same slot, and
+    // renders the placeholder till the image is uploaded
+    if (!handle_slots_[index].texture and !handle_slots_[index].path.empty()) {
+      const std::string path = handle_slots_[index].path;
+      GetTextureAsync(path, handle_slots_[index].linear);
+    }
+    
+    HandleSlot& slot = handle_slots_[index];
+    slot.last_used_frame = frame_;
+    return slot.texture;
+  }
+  
+  void TextureLibrary::MarkInUse(TextureHandle handle) {
+    uint32_t index = handle.GetIndex();
+    RETURN_IF(handle.value_ == 0 or index >= handle_slots_.size() or handle_slots_[index].generation != handle.GetGeneration());
+    handle_slots_[index].last_used_frame = frame_;
+  }
+  
+  void TextureLibrary::UpdateHandle(TextureEntry& entry, const std::string& path, bool linear) {
+    if (!entry.handle.value_) {
+      uint32_t index = AllocateHandleSlot();
+      handle_slots_[index].path = path;
+      handle_slots_[index].linear = linear;
+      entry.handle = TextureHandle(index, handle_slots_[index].generation);
+    }
+    
+    uint32_t index = entry.handle.GetIndex();
+    handle_slots_[index].texture = entry.texture.get();
+    handle_slots_[index].last_used_frame = frame_;
+    texture_handles_[entry.texture.get()] = index;
+  }
+  
+  uint32_t TextureLibrary::AllocateHandleSlot() {
+    if (!free_handle_slots_.empty()) {
+      uint32_t index = free_handle_slots_.back();
+      free_handle_slots_.pop_back();
+      return index;
     }
+    
+    IK_CORE_ASSERT(handle_slots_.size() <= TextureHandle::IndexMask, "Texture handle table is full");
+    handle_slots_.emplace_back();
+    return (uint32_t)handle_slots_.size() - 1;
+  }
+  
+  void TextureLibrary::FreeHandleSlot(uint32_t index) {
+    HandleSlot& slot = handle_slots_[index];
+    if (slot.texture)
+      texture_handles_.erase(slot.texture);
+    
+    // Generation 0 is never used, so that null handle is never valid
+    uint32_t generation = slot.generation == TextureHandle::MaxGeneration ? 1 : slot.generation + 1;
+    slot = HandleSlot();
+    slot.generation = generation;
+    free_handle_slots_.push_back(index);
+  }
+  
+  void TextureLibrary::ReleaseHandle(const Texture* texture) {
+    auto it = texture_handles_.find(texture);
+    RETURN_IF(it == texture_handles_.end());
+    
+    uint32_t index = it->second;
+    texture_handles_.erase(it);
+    
+    // Library texture keeps its slot, to be loaded again. Slot of other texture is reused
+    HandleSlot& slot = handle_slots_[index];
+    slot.texture = nullptr;
+    if (slot.path.empty())
+      FreeHandleSlot(index);
   }
   
 } // namespace ikan
@@ -0,0 +1,398 @@
+//
+//  texture_atlas.cpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "texture_atlas.hpp"
+
+#include <stb_image.h>
+#include <filesystem>
+#include <unordered_set>
+
+namespace ikan {
+
+  namespace texture_atlas_utils {
+
+    /// Number of channels in atlas page (RGBA)
+    static constexpr uint32_t PageChannels = 4;
+
+    /// Header of atlas file. File stores header, then regions (path length, path, page, uv rect) and then the pixels of all pages
+    struct FileHeader {
+      static constexpr uint32_t Magic = 0x54414B49; // "IKAT"
+      static constexpr uint32_t Version = 1;
+
+      uint32_t magic = Magic;
+      uint32_t version = Version;
+      uint32_t page_size = 0;
+      uint32_t num_pages = 0;
+      uint32_t num_images = 0;
+      uint32_t linear = 1;
+    };
+
+    /// Location of image in atlas
+    struct PackedImage {
+      std::string path;
+      uint32_t page = 0;
+      glm::vec4 uv_rect = {0.0f, 0.0f, 0.0f, 0.0f}; // min u, min v, max u, max v
+    };
+
+    /// This class packs the rectangles in square page with skyline bottom left heuristic. Skyline is the top edge of packed
+    /// rectangles, stored as horizontal segments from left to right
+    class SkylinePacker {
+    public:
+      SkylinePacker(int32_t size) : size_(size) {
+        skyline_.push_back({0, 0, size});
+      }
+
+      /// This function packs the rectangle at lowest position of skyline. Returns false if page is full
+      /// - Parameters:
+      ///   - rect_size: size of rectangle
+      ///   - position: bottom left of packed rectangle (output)
+      bool Insert(const glm::ivec2& rect_size, glm::ivec2& position) {
+        int32_t best_idx = -1;
+        int32_t best_y = std::numeric_limits<int32_t>::max();
+        for (size_t i = 0; i < skyline_.size(); i++) {
+          int32_t y = 0;
+          if (Fits(i, rect_size, y) and y < best_y) {
+            best_idx = (int32_t)i;
+            best_y = y;
+          }
+        }
+        if (best_idx < 0)
+          return false;
+
+        position = { skyline_[best_idx].x, best_y };
+        skyline_.insert(skyline_.begin() + best_idx, { position.x, best_y + rect_size.y, rect_size.x });
+
+        // Shrink (or remove) the segments under the new segment
+        for (size_t i = best_idx + 1; i < skyline_.size(); ) {
+          const int32_t prev_end = skyline_[i - 1].x + skyline_[i - 1].width;
+          if (skyline_[i].x >= prev_end)
+            break;
+
+          const int32_t shrink = prev_end - skyline_[i].x;
+          if (skyline_[i].width <= shrink) {
+            skyline_.erase(skyline_.begin() + i);
+            continue;
+          }
+          skyline_[i].x += shrink;
+          skyline_[i].width -= shrink;
+          break;
+        }
+
+        // Merge the neighbour segments at same height
+        for (size_t i = 0; i + 1 < skyline_.size(); ) {
+          if (skyline_[i].y == skyline_[i + 1].y) {
+            skyline_[i].width += skyline_[i + 1].width;
+            skyline_.erase(skyline_.begin() + i + 1);
+          }
+          else {
+            i++;
+          }
+        }
+        return true;
+      }
+
+    private:
+      /// Horizontal segment of skyline
+      struct Segment {
+        int32_t x, y, width;
+      };
+
+      /// This function checks if rectangle fits with its left edge at segment. Returns the bottom of rectangle in y
+      bool Fits(size_t idx, const glm::ivec2& rect_size, int32_t& y) const {
+        if (skyline_[idx].x + rect_size.x > size_)
+          return false;
+
+        // Rectangle rests on the highest segment it covers
+        int32_t width_left = rect_size.x;
+        y = 0;
+        while (width_left > 0) {
+          y = std::max(y, skyline_[idx].y);
+          if (y + rect_size.y > size_)
+            return false;
+          width_left -= skyline_[idx].width;
+          idx++;
+        }
+        return true;
+      }
+
+      int32_t size_ = 0;
+      std::vector<Segment> skyline_;
+    };
+
+    /// This function copies the RGBA image in page and extrudes its edge pixels in padding
+    /// - Parameters:
+    ///   - image: pixels of image
+    ///   - size: size of image
+    ///   - page: pixels of page
+    ///   - page_size: size of page
+    ///   - position: position of packed rectangle (image with padding)
+    ///   - padding: padding around image
+    static void CopyImageInPage(const uint8_t* image, const glm::ivec2& size, uint8_t* page, int32_t page_size,
+                                const glm::ivec2& position, int32_t padding) {
+      for (int32_t row = -padding; row < size.y + padding; row++) {
+        const uint8_t* src = image + (size_t)std::clamp(row, 0, size.y - 1) * size.x * PageChannels;
+        uint8_t* dst = page + ((size_t)(position.y + padding + row) * page_size + position.x) * PageChannels;
+
+        for (int32_t col = 0; col < padding; col++)
+          memcpy(dst + col * PageChannels, src, PageChannels);
+        memcpy(dst + padding * PageChannels, src, (size_t)size.x * PageChannels);
+        for (int32_t col = 0; col < padding; col++)
+          memcpy(dst + (padding + size.x + col) * PageChannels, src + (size.x - 1) * PageChannels, PageChannels);
+      }
+    }
+
+    /// This function packs the images in atlas pages
+    /// - Parameters:
+    ///   - texture_paths: paths of images
+    ///   - spec: specification of atlas
+    ///   - images: packed images (output)
+    ///   - pages: pixels of pages (output)
+    static void PackImages(const std::vector<std::string>& texture_paths, const TextureAtlas::Specification& spec,
+                           std::vector<PackedImage>& images, std::vector<std::vector<uint8_t>>& pages) {
+      const int32_t page_size = (int32_t)spec.page_size;
+      const int32_t padding = (int32_t)spec.padding;
+
+      // Read only the size of images. Images with less than 3 channels are rendered as red texture, so they are not packed
+      struct Input {
+        std::string path;
+        glm::ivec2 size;
+        glm::ivec2 position;
+        uint32_t page;
+      };
+      std::vector<Input> inputs;
+      std::unordered_set<std::string> unique_paths;
+      for (const auto& path : texture_paths) {
+        if (!unique_paths.insert(path).second)
+          continue;
+
+        int32_t width = 0, height = 0, channels = 0;
+        if (!stbi_info(path.c_str(), &width, &height, &channels) or channels < 3 or
+            width + 2 * padding > page_size or height + 2 * padding > page_size) {
+          IK_CORE_DEBUG(LogModule::TextureAtlas, "  Skipping '{0}' from atlas", StringUtils::GetNameFromFilePath(path));
+          continue;
+        }
+        inputs.push_back({ path, { width, height }, { 0, 0 }, 0 });
+      }
+
+      // Taller images first gives flatter skyline
+      std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) {
+        return a.size.y != b.size.y ? a.size.y > b.size.y : a.size.x > b.size.x;
+      });
+
+      std::vector<SkylinePacker> packers;
+      for (auto& input : inputs) {
+        const glm::ivec2 rect_size = input.size + 2 * padding;
+        bool packed = false;
+        for (uint32_t page = 0; page < packers.size() and !packed; page++) {
+          packed = packers[page].Insert(rect_size, input.position);
+          input.page = page;
+        }
+        if (!packed) {
+          packers.emplace_back(page_size).Insert(rect_size, input.position);
+          input.page = (uint32_t)packers.size() - 1;
+        }
+      }
+
+      pages.assign(packers.size(), std::vector<uint8_t>((size_t)page_size * page_size * PageChannels, 0));
+
+      // Decode and copy the images in parallel. Packed rectangles do not overlap, so each image writes its own pixels
+      // NOTE: Decoded same as Texture loaded from file (flipped RGBA, from texture cache if not changed), so that UVs of sprites are same
+      //       in atlas. Level 0 is first in pixels, if cache stores mip levels
+      Input* input_data = inputs.data();
+      std::vector<uint8_t>* page_data = pages.data();
+      dispatch_apply(inputs.size(), loop_dispactch_queue_, ^(size_t i) {
+        Input& input = input_data[i];
+        TextureImage image = TextureImage::Decode(input.path);
+        if (!image.pixels or image.width != input.size.x or image.height != input.size.y) {
+          input.size = { 0, 0 };
+        }
+        else {
+          CopyImageInPage(image.pixels.get(), input.size, page_data[input.page].data(), page_size, input.position, padding);
+        }
+      });
+
+      for (const auto& input : inputs) {
+        if (input.size.x == 0)
+          continue;
+        const glm::vec2 min = glm::vec2(input.position + padding), max = min + glm::vec2(input.size);
+        images.push_back({ input.path, input.page, glm::vec4(min, max) / (float)page_size });
+      }
+    }
+
+    /// This function creates the atlas from packed pages
+    /// - Parameters:
+    ///   - images: packed images
+    ///   - pages: pixels of pages
+    ///   - page_size: size of page
+    ///   - linear: linear filter of pages
+    static std::shared_ptr<TextureAtlas> CreateAtlas(const std::vector<PackedImage>& images, std::vector<std::vector<uint8_t>>& pages,
+                                                     uint32_t page_size, bool linear) {
+      std::vector<std::shared_ptr<Texture>> page_textures;
+      for (auto& page : pages)
+        page_textures.push_back(Texture::Create(page_size, page_size, page.data(), (uint32_t)page.size(), linear));
+
+      std::unordered_map<std::string, std::shared_ptr<SubTexture>> regions;
+      for (const auto& image : images) {
+        regions[image.path] = std::make_shared<SubTexture>(page_textures[image.page], glm::vec2(image.uv_rect.x, image.uv_rect.y),
+                                                           glm::vec2(image.uv_rect.z, image.uv_rect.w));
+      }
+      return std::make_shared<TextureAtlas>(std::move(page_textures), std::move(regions), linear);
+    }
+
+  } // namespace texture_atlas_utils
+
+  using namespace texture_atlas_utils;
+
+  TextureAtlas::TextureAtlas(std::vector<std::shared_ptr<Texture>>&& pages,
+                             std::unordered_map<std::string, std::shared_ptr<SubTexture>>&& regions,
+                             bool linear)
+  : pages_(std::move(pages)), regions_(std::move(regions)), linear_(linear) {
+    IK_CORE_TRACE(LogModule::TextureAtlas, "Creating Texture Atlas ...");
+    IK_CORE_TRACE(LogModule::TextureAtlas, "  Images {0}", regions_.size());
+    IK_CORE_TRACE(LogModule::TextureAtlas, "  Pages  {0}", pages_.size());
+  }
+
+  std::shared_ptr<TextureAtlas> TextureAtlas::Create(const std::vector<std::string>& texture_paths, const Specification& spec) {
+    std::vector<PackedImage> images;
+    std::vector<std::vector<uint8_t>> pages;
+    PackImages(texture_paths, spec, images, pages);
+    return CreateAtlas(images, pages, spec.page_size, spec.linear);
+  }
+
+  bool TextureAtlas::Pack(const std::vector<std::string>& texture_paths, const std::string& atlas_file_path, const Specification& spec) {
+    std::vector<PackedImage> images;
+    std::vector<std::vector<uint8_t>> pages;
+    PackImages(texture_paths, spec, images, pages);
+
+    std::ofstream file(atlas_file_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      IK_CORE_WARN(LogModule::TextureAtlas, "Can not write the Texture Atlas '{0}'", atlas_file_path.c_str());
+      return false;
+    }
+
+    FileHeader header;
+    header.page_size = spec.page_size;
+    header.num_pages = (uint32_t)pages.size();
+    header.num_images = (uint32_t)images.size();
+    header.linear = spec.linear;
+    file.write((const char*)&header, sizeof(FileHeader));
+
+    for (const auto& image : images) {
+      const uint32_t path_length = (uint32_t)image.path.size();
+      file.write((const char*)&path_length, sizeof(uint32_t));
+      file.write(image.path.data(), path_length);
+      file.write((const char*)&image.page, sizeof(uint32_t));
+      file.write((const char*)&image.uv_rect, sizeof(glm::vec4));
+    }
+    for (const auto& page : pages)
+      file.write((const char*)page.data(), (std::streamsize)page.size());
+
+    IK_CORE_INFO(LogModule::TextureAtlas, "Packed {0} Images of {1} in {2} Pages '{3}'", images.size(), texture_paths.size(), pages.size(),
+                 atlas_file_path.c_str());
+    return (bool)file;
+  }
+
+  std::shared_ptr<TextureAtlas> TextureAtlas::Load(const std::string& atlas_file_path) {
+    std::ifstream file(atlas_file_path, std::ios::binary | std::ios::ate);
+    if (!file) {
+      IK_CORE_WARN(LogModule::TextureAtlas, "Can not read the Texture Atlas '{0}'", atlas_file_path.c_str());
+      return nullptr;
+    }
+
+    std::vector<uint8_t> content((size_t)file.tellg());
+    file.seekg(0);
+    file.read((char*)content.data(), (std::streamsize)content.size());
+
+    // Reads the data from content. Returns false if content is shorter than data
+    size_t offset = 0;
+    auto read = [&content, &offset](void* data, size_t size) {
+      if (offset + size > content.size())
+        return false;
+      memcpy(data, content.data() + offset, size);
+      offset += size;
+      return true;
+    };
+
+    FileHeader header;
+    const FileHeader expected;
+    bool valid = read(&header, sizeof(FileHeader)) and header.magic == expected.magic and header.version == expected.version;
+
+    std::vector<PackedImage> images(valid ? header.num_images : 0);
+    for (auto& image : images) {
+      uint32_t path_length = 0;
+      valid = valid and read(&path_length, sizeof(uint32_t)) and path_length <= content.size();
+      if (!valid)
+        break;
+      image.path.resize(path_length);
+      valid = read(image.path.data(), path_length) and read(&image.page, sizeof(uint32_t)) and read(&image.uv_rect, sizeof(glm::vec4)) and
+              image.page < header.num_pages;
+    }
+
+    const size_t page_bytes = (size_t)header.page_size * header.page_size * PageChannels;
+    if (!valid or content.size() - offset != page_bytes * header.num_pages) {
+      IK_CORE_WARN(LogModule::TextureAtlas, "Invalid Texture Atlas '{0}'", atlas_file_path.c_str());
+      return nullptr;
+    }
+
+    std::vector<std::vector<uint8_t>> pages(header.num_pages);
+    for (auto& page : pages) {
+      page.assign(content.data() + offset, content.data() + offset + page_bytes);
+      offset += page_bytes;
+    }
+    return CreateAtlas(images, pages, header.page_size, header.linear);
+  }
+
+  std::vector<std::string> TextureAtlas::GetImagesInDirectory(const std::string& directory) {
+    std::vector<std::string> paths;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, error)) {
+      if (!entry.is_regular_file())
+        continue;
+
+      std::string extension = entry.path().extension().string();
+      std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+      if (extension == ".png" or extension == ".jpg" or extension == ".jpeg")
+        paths.push_back(entry.path().string());
+    }
+    return paths;
+  }
+
+  bool TextureAtlas::Remap(TextureHandle texture, glm::vec4& uv_rect, TextureHandle& page) const {
+    if (!texture)
+      return false;
+
+    // Find the region by path and filter only for new texture handle. Texture with other filter than pages is not remapped
+    auto cached = texture_regions_.find(texture.GetValue());
+    if (cached == texture_regions_.end()) {
+      const Texture* texture_ptr = texture.Get();
+      if (!texture_ptr)
+        return false;
+      const SubTexture* region = nullptr;
+      if (texture_ptr->IsLinear() == linear_) {
+        auto it = regions_.find(texture_ptr->GetfilePath());
+        region = it != regions_.end() ? it->second.get() : nullptr;
+      }
+      cached = texture_regions_.emplace(texture.GetValue(), region).first;
+    }
+    const SubTexture* region = cached->second;
+    if (!region)
+      return false;
+
+    // Map the UVs of texture in region of page
+    const glm::vec2* coords = region->GetTexCoord();
+    const glm::vec2 min = coords[0], size = coords[2] - coords[0];
+    uv_rect = { min + glm::vec2(uv_rect.x, uv_rect.y) * size, min + glm::vec2(uv_rect.z, uv_rect.w) * size };
+    page = region->GetSpriteHandle();
+    return true;
+  }
+
+  std::shared_ptr<SubTexture> TextureAtlas::GetSubTexture(const std::string& texture_path) const {
+    auto it = regions_.find(texture_path);
+    return it != regions_.end() ? it->second : nullptr;
+  }
+
+} // namespace ikan
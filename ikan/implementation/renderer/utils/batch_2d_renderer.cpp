@@ -12,6 +12,11 @@
 #include "renderer/graphics/shader.hpp"
 #include "renderer/graphics/texture.hpp"
 
+#include <glm/gtc/packing.hpp>
+#include <atomic>
+#include <bit>
+#include <thread>
+
 namespace ikan {
 
 #define BATCH_INFO(...) IK_CORE_INFO(LogModule::Batch2DRenderer, __VA_ARGS__)
@@ -20,12 +25,36 @@ namespace ikan {
   static constexpr glm::vec2 texture_coords_[] = {
     { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }
   };
+  
+  /// Bulk quads below this count are generated on calling thread, as dispatching workers costs more than generating them
+  static constexpr size_t ParallelQuadThreshold = 4096;
+  /// Number of quads claimed by a worker at once while generating bulk quads
+  static constexpr size_t ParallelQuadChunk = 1024;
+  /// Number of quads whose corners are generated together (vectorized across quads) in stack scratch of WriteBulkQuads
+  static constexpr size_t BulkCornerBlock = 64;
+
+  /// Batch capacity is not grown beyond this (unless reserved explicitly with AddQuadData/AddCircleData/AddLineData)
+  static constexpr uint32_t MaxAdaptiveElements = 16384;
+  /// Number of frames after which the flush histogram is checked to shrink the batch capacity
+  static constexpr uint32_t AdaptiveWindowFrames = 120;
+
+  /// Vertex format of Quad and Circle batches. Used when batch data is added or re created
+  static Batch2DRenderer::VertexFormat vertex_format_ = Batch2DRenderer::VertexFormat::Full;
 
   /// This structure holds the common batch renderer data for Quads, circle and lines
   struct CommonBatchData {
     /// Max element to be rendered in single batch
     uint32_t max_element = 0;
     uint32_t max_vertices = 0;
+    /// Capacity reserved by user. Batch capacity never shrinks below this
+    uint32_t min_element = 0;
+    
+    /// Histogram of elements per flush in current window. Bucket i counts the flushes with elements in [2^(i-1), 2^i)
+    std::array<uint32_t, 32> flush_histogram = {};
+    /// Elements flushed and flushes of full batch since previous frame boundary
+    uint32_t frame_elements = 0, frame_full_flushes = 0;
+    /// Frames passed in current histogram window
+    uint32_t window_frames = 0;
     
     std::shared_ptr<Pipeline> pipeline;
     std::shared_ptr<VertexBuffer> vertex_buffer;
@@ -42,11 +71,49 @@ namespace ikan {
     void CommonInit(uint32_t max_elem, uint32_t max_vertices_single_elem) {
       max_element = max_elem;
       max_vertices = max_elem * max_vertices_single_elem;
+      min_element = max_elem;
       
       // Create Pipeline instance
       pipeline = Pipeline::Create();
     }
     
+    /// This function records the number of elements rendered in a flush
+    /// - Parameter elements: number of elements in flushed batch
+    void RecordFlush(uint32_t elements) {
+      flush_histogram[std::bit_width(elements)]++;
+      frame_elements += elements;
+      if (elements >= max_element)
+        frame_full_flushes++;
+    }
+    
+    /// This function returns the batch capacity for next frame, based on the flushes of previous frame and histogram of current window
+    ///   - Grows (at least double) as soon as a frame needs more than one flush because batch is full
+    ///   - Shrinks to twice the peak flush, if peak of whole window uses less than a quarter of capacity
+    uint32_t NextCapacity() {
+      uint32_t capacity = max_element;
+      if (frame_full_flushes > 0) {
+        capacity = std::max(max_element * 2, std::bit_ceil(frame_elements));
+        capacity = std::max(std::min(capacity, MaxAdaptiveElements), max_element);
+      }
+      else if (++window_frames >= AdaptiveWindowFrames) {
+        // Upper bound of the largest flush of window
+        uint32_t peak = 0;
+        for (uint32_t bucket = 0; bucket < flush_histogram.size(); bucket++) {
+          if (flush_histogram[bucket])
+            peak = 1u << bucket;
+        }
+        if (peak * 4 <= max_element)
+          capacity = std::max(peak * 2, min_element);
+        
+        flush_histogram.fill(0);
+        window_frames = 0;
+      }
+      
+      frame_elements = 0;
+      frame_full_flushes = 0;
+      return capacity;
+    }
+    
     virtual ~CommonBatchData() {
       pipeline.reset();
       vertex_buffer.reset();
@@ -71,24 +138,52 @@ namespace ikan {
       float texture_index;
       float tiling_factor;
     };
+    
+    /// Single packed vertex for a Quad or Circle. Tiling factor is folded in texture coordinates
+    struct CommonPackedVertex {
+      glm::vec3 position;
+      uint32_t color;           // RGBA8
+      uint32_t texture_coords;  // Half float x 2
+      uint32_t texture_index;   // Only first byte is used
+    };
 
     // Constants
     static constexpr uint32_t VertexForSingleElement = 4;
     static constexpr uint32_t IndicesForSingleElement = 6;
     
+    /// Size of single vertex (or instance) in bytes (depends on Vertex format)
+    uint32_t vertex_size = 0;
     /// Store the Vertex and Indices size
     uint32_t max_indices = 0;
     /// Count of Indices to be renderer in Single Batch
     uint32_t index_count = 0;
+    /// Flag to render the batch as instances of single element (index_count / IndicesForSingleElement instances)
+    bool instanced = false;
 
     /// Stores all the 16 Texture in array so that there is no need to load texture each frame
-    /// NOTE: Load only if new texture is added or older replaced with new
-    std::array<std::shared_ptr<Texture>, MaxTextureSlotsInShader> texture_slots;
+    /// NOTE: Load only if new texture is added or older replaced with new. Textures are owned by library (or submitter) and alive till
+    /// the batch is flushed
+    std::array<const Texture*, MaxTextureSlotsInShader> texture_slots = {};
+    /// White texture for colorful quads witout any texture or sprite (Slot 0)
+    std::shared_ptr<Texture> white_texture;
     
     /// Texture Slot index sent to Shader to render a specific Texture from slots
     /// Slot 0 is reserved for white texture (No Image only color)
     uint32_t texture_slot_index = 1; // 0 = white texture
 
+    /// Slot stamp of a texture. Slot is valid only if stamp generation is same as current batch generation
+    struct SlotStamp {
+      uint32_t generation = 0;
+      uint32_t slot = 0;
+    };
+    /// Direct mapped table of slot stamps, indexed by texture renderer ID
+    std::vector<SlotStamp> slot_stamps;
+    /// Generation of current batch. Incremented on each new batch, so that all previous stamps get invalid
+    uint32_t batch_generation = 0;
+
+    /// Number of elements the index buffer is created for. Index buffer is created again only if capacity grows beyond this
+    uint32_t index_capacity = 0;
+
     /// Basic vertex of quad (Vertex of circle is taken as Quad only)
     glm::vec4 vertex_base_position[4];
 
@@ -97,15 +192,41 @@ namespace ikan {
       max_indices = max_elements * IndicesForSingleElement;
       
       // Creating white texture for colorful quads witout any texture or sprite
-      if (!texture_slots[0]) {
+      if (!white_texture) {
         uint32_t whiteTextureData = 0xffffffff;
-        texture_slots[0] = Texture::Create(1, 1, &whiteTextureData, sizeof(uint32_t));
+        white_texture = Texture::Create(1, 1, &whiteTextureData, sizeof(uint32_t));
+        texture_slots[0] = white_texture.get();
       }
       
+      ReserveIndices(max_elements);
+      
+      // Setting basic Vertex point of quad
+      vertex_base_position[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
+      vertex_base_position[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
+      vertex_base_position[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
+      vertex_base_position[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
+    }
+    
+    /// This function updates the capacity of batch. Index buffer is created again only if it can not index the new capacity
+    /// - Parameter max_elements: new max elements in single batch
+    void SetCapacity(uint32_t max_elements) {
+      max_element = max_elements;
+      max_vertices = max_elements * VertexForSingleElement;
+      max_indices = max_elements * IndicesForSingleElement;
+      ReserveIndices(max_elements);
+    }
+    
+    /// This function creates the index buffer for elements, if current index buffer is smaller
+    /// - Parameter max_elements: max elements to be indexed
+    void ReserveIndices(uint32_t max_elements) {
+      RETURN_IF(max_elements <= index_capacity);
+      index_capacity = max_elements;
+      
       // Create Index Buffer
-      uint32_t* indices = new uint32_t[max_indices];
+      const uint32_t num_indices = index_capacity * IndicesForSingleElement;
+      uint32_t* indices = new uint32_t[num_indices];
       uint32_t offset = 0;
-      for (size_t i = 0; i < max_indices; i += Shape2DCommonData::IndicesForSingleElement) {
+      for (size_t i = 0; i < num_indices; i += Shape2DCommonData::IndicesForSingleElement) {
         indices[i + 0] = offset + 0;
         indices[i + 1] = offset + 1;
         indices[i + 2] = offset + 2;
@@ -118,15 +239,9 @@ namespace ikan {
       }
       
       // Create Index Buffer in GPU for storing Indices
-      std::shared_ptr<IndexBuffer> ib = IndexBuffer::CreateWithCount(indices, max_indices);
+      std::shared_ptr<IndexBuffer> ib = IndexBuffer::CreateWithCount(indices, num_indices);
       pipeline->SetIndexBuffer(ib);
       delete[] indices;
-      
-      // Setting basic Vertex point of quad
-      vertex_base_position[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
-      vertex_base_position[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
-      vertex_base_position[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
-      vertex_base_position[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
     }
     
     void StartCommonBatch(const glm::mat4& cam_view_proj_mat) {
@@ -137,6 +252,29 @@ namespace ikan {
     void StartCommonBatch() {
       index_count = 0;
       texture_slot_index = 1;
+      batch_generation++;
+    }
+    
+    /// This function returns the slot of texture in current batch. Returns 0 if texture is not loaded in current batch
+    /// - Parameter renderer_id: renderer ID of texture
+    uint32_t FindTextureSlot(RendererID renderer_id) const {
+      if (renderer_id < slot_stamps.size() and slot_stamps[renderer_id].generation == batch_generation)
+        return slot_stamps[renderer_id].slot;
+      return 0;
+    }
+    
+    /// This function loads the texture in the first free slot and returns the slot
+    /// - Parameters:
+    ///   - texture: texture to be loaded
+    ///   - renderer_id: renderer ID of texture
+    uint32_t AddTextureSlot(const Texture* texture, RendererID renderer_id) {
+      if (renderer_id >= slot_stamps.size())
+        slot_stamps.resize(renderer_id + 1);
+      
+      uint32_t slot = texture_slot_index++;
+      texture_slots[slot] = texture;
+      slot_stamps[renderer_id] = { batch_generation, slot };
+      return slot;
     }
     
     void Flush() {
@@ -146,12 +284,19 @@ namespace ikan {
         texture_slots[i]->Bind(i);
       
       // Render the Scene
-      Renderer::DrawIndexed(pipeline, index_count);
+      if (instanced) {
+        uint32_t instance_count = index_count / IndicesForSingleElement;
+        Renderer::DrawIndexedInstanced(pipeline, IndicesForSingleElement, instance_count);
+        RendererStatistics::Get().stats_2d_.instanced_draw_calls++;
+      }
+      else {
+        Renderer::DrawIndexed(pipeline, index_count);
+      }
     }
 
     virtual ~Shape2DCommonData() {
-      for(auto texture : texture_slots)
-        texture.reset();
+      texture_slots.fill(nullptr);
+      white_texture.reset();
     }
   };
   
@@ -161,12 +306,62 @@ namespace ikan {
     struct Vertex : CommonVertex {
       int32_t pixel_id;
     };
+    /// Single packed vertex of a Quad
+    struct PackedVertex : CommonPackedVertex {
+      int32_t pixel_id;
+    };
+    /// Single vertex of unified shape batch. Fragment shader selects the shape (quad, circle or rounded rect) from shape kind
+    struct ShapeVertex : CommonVertex {
+      glm::vec2 local_position; // [-1, 1] for circle, [-half size, half size] for rounded rect
+      glm::vec2 half_size;      // Half size of rounded rect in world units
+      glm::vec3 shape;          // Shape kind, thickness (circle) or corner radius (rounded rect), fade
+      int32_t pixel_id;
+    };
+    /// Single instance of a Quad. Vertex shader expands the unit quad with this data
+    struct Instance {
+      glm::vec4 affine;         // 2x2 matrix (x axis, y axis) of transform
+      glm::vec3 translation;    // z is used as depth
+      glm::vec4 uv_rect;        // min u, min v, max u, max v (tiling factor folded in)
+      uint32_t color;           // RGBA8
+      uint32_t texture_index;   // Only first byte is used
+      int32_t pixel_id;
+    };
     
     /// Base pointer of Vertex Data. This is start of Batch data for single draw call
     Vertex* vertex_buffer_base_ptr = nullptr;
     /// Incrememntal Vetrtex Data Pointer to store all the batch data in Buffer
     Vertex* vertex_buffer_ptr = nullptr;
     
+    /// Base pointer of Packed Vertex Data. Used only for Packed vertex format
+    PackedVertex* packed_vertex_buffer_base_ptr = nullptr;
+    /// Incrememntal Packed Vetrtex Data Pointer
+    PackedVertex* packed_vertex_buffer_ptr = nullptr;
+    
+    /// Base pointer of Instance Data. Used only for Instanced vertex format
+    Instance* instance_buffer_base_ptr = nullptr;
+    /// Incrememntal Instance Data Pointer
+    Instance* instance_buffer_ptr = nullptr;
+    /// Static vertex buffer of unit quad corners. Used only for Instanced vertex format
+    std::shared_ptr<VertexBuffer> unit_quad_buffer;
+    
+    /// Base pointer of Shape Vertex Data. Used only for Unified vertex format
+    ShapeVertex* shape_vertex_buffer_base_ptr = nullptr;
+    /// Incrememntal Shape Vetrtex Data Pointer
+    ShapeVertex* shape_vertex_buffer_ptr = nullptr;
+    
+    /// Range of bulk quads rendered in one batch
+    struct BulkSegment {
+      size_t first_quad = 0, end_quad = 0;
+      /// Textures to be loaded in batch (from first_slot)
+      uint32_t first_slot = 1, num_slots = 1;
+      std::array<const Texture*, MaxTextureSlotsInShader> textures;
+    };
+    
+    /// Scratch data of bulk quad submission. Reused each call to avoid reallocation
+    std::vector<uint8_t> bulk_vertices;
+    std::vector<uint8_t> bulk_texture_indices;
+    std::vector<BulkSegment> bulk_segments;
+    
     void StartBatch(const glm::mat4& cam_view_proj_mat) {
       StartCommonBatch(cam_view_proj_mat);
       StartBatch();
@@ -174,11 +369,149 @@ namespace ikan {
     void StartBatch() {
       StartCommonBatch();
       vertex_buffer_ptr = vertex_buffer_base_ptr;
+      packed_vertex_buffer_ptr = packed_vertex_buffer_base_ptr;
+      instance_buffer_ptr = instance_buffer_base_ptr;
+      shape_vertex_buffer_ptr = shape_vertex_buffer_base_ptr;
+    }
+    
+    /// This function stores the instance of quad in current batch
+    /// - Parameters:
+    ///   - affine: 2x2 matrix of quad transform (x axis, y axis)
+    ///   - translation: translation of quad
+    ///   - uv_rect: texture coordinates as min and max uv
+    ///   - color: color of quad
+    ///   - texture_index: slot of texture
+    ///   - object_id: object/pixel id
+    void AddInstance(const glm::vec4& affine, const glm::vec3& translation, const glm::vec4& uv_rect, const glm::vec4& color,
+                     uint32_t texture_index, int32_t object_id) {
+      instance_buffer_ptr->affine         = affine;
+      instance_buffer_ptr->translation    = translation;
+      instance_buffer_ptr->uv_rect        = uv_rect;
+      instance_buffer_ptr->color          = glm::packUnorm4x8(color);
+      instance_buffer_ptr->texture_index  = texture_index;
+      instance_buffer_ptr->pixel_id       = object_id;
+      instance_buffer_ptr++;
+      
+      RendererStatistics::Get().stats_2d_.quad_instances++;
+    }
+    
+    /// This function stores the 4 vertices of a shape in current unified batch
+    /// - Parameters:
+    ///   - transform: transform matrix of shape
+    ///   - texture_coords: texture coordinates of 4 vertices
+    ///   - tiling_factor: tiling factor of texture
+    ///   - color: color of shape
+    ///   - texture_index: slot of texture
+    ///   - kind: shape kind
+    ///   - param: thickness of circle or corner radius of rounded rect
+    ///   - fade: fade of shape edge
+    ///   - object_id: object/pixel id
+    void AddShape(const glm::mat4& transform, const glm::vec2* texture_coords, float tiling_factor, const glm::vec4& color,
+                  float texture_index, Batch2DRenderer::ShapeKind kind, float param, float fade, int32_t object_id) {
+      glm::vec2 half_size = { 1.0f, 1.0f };
+      if (kind == Batch2DRenderer::ShapeKind::RoundedRect)
+        half_size = { 0.5f * glm::length(glm::vec2(transform[0])), 0.5f * glm::length(glm::vec2(transform[1])) };
+      
+      const glm::vec3 shape = { (float)kind, param, fade };
+      for (size_t i = 0; i < VertexForSingleElement; i++) {
+        shape_vertex_buffer_ptr->position         = transform * vertex_base_position[i];
+        shape_vertex_buffer_ptr->color            = color;
+        shape_vertex_buffer_ptr->texture_coords   = texture_coords[i];
+        shape_vertex_buffer_ptr->texture_index    = texture_index;
+        shape_vertex_buffer_ptr->tiling_factor    = tiling_factor;
+        shape_vertex_buffer_ptr->local_position   = 2.0f * glm::vec2(vertex_base_position[i]) * half_size;
+        shape_vertex_buffer_ptr->half_size        = half_size;
+        shape_vertex_buffer_ptr->shape            = shape;
+        shape_vertex_buffer_ptr->pixel_id         = object_id;
+        shape_vertex_buffer_ptr++;
+      }
+    }
+    
+    /// This function returns the size of data of single quad in bytes (4 vertices or 1 instance)
+    uint32_t QuadSize() const {
+      return instanced ? vertex_size : vertex_size * VertexForSingleElement;
+    }
+    /// This function returns the current write pointer of batch data
+    uint8_t* DataPtr() const {
+      if (shape_vertex_buffer_base_ptr)
+        return (uint8_t*)shape_vertex_buffer_ptr;
+      if (instance_buffer_base_ptr)
+        return (uint8_t*)instance_buffer_ptr;
+      if (packed_vertex_buffer_base_ptr)
+        return (uint8_t*)packed_vertex_buffer_ptr;
+      return (uint8_t*)vertex_buffer_ptr;
+    }
+    /// This function moves the write pointer of batch data after the quads written directly at DataPtr()
+    /// - Parameter num_quads: number of quads written
+    void AdvanceQuads(uint32_t num_quads) {
+      if (shape_vertex_buffer_base_ptr)
+        shape_vertex_buffer_ptr += num_quads * VertexForSingleElement;
+      else if (instance_buffer_base_ptr)
+        instance_buffer_ptr += num_quads;
+      else if (packed_vertex_buffer_base_ptr)
+        packed_vertex_buffer_ptr += num_quads * VertexForSingleElement;
+      else
+        vertex_buffer_ptr += num_quads * VertexForSingleElement;
+      index_count += num_quads * IndicesForSingleElement;
+    }
+    
+    /// This function returns the size of vertex data stored in current batch
+    uint32_t DataSize() const {
+      if (shape_vertex_buffer_base_ptr)
+        return (uint32_t)((uint8_t*)shape_vertex_buffer_ptr - (uint8_t*)shape_vertex_buffer_base_ptr);
+      if (instance_buffer_base_ptr)
+        return (uint32_t)((uint8_t*)instance_buffer_ptr - (uint8_t*)instance_buffer_base_ptr);
+      if (packed_vertex_buffer_base_ptr)
+        return (uint32_t)((uint8_t*)packed_vertex_buffer_ptr - (uint8_t*)packed_vertex_buffer_base_ptr);
+      return (uint32_t)((uint8_t*)vertex_buffer_ptr - (uint8_t*)vertex_buffer_base_ptr);
+    }
+    /// This function returns the base pointer of vertex data
+    void* DataBasePtr() const {
+      if (shape_vertex_buffer_base_ptr)
+        return shape_vertex_buffer_base_ptr;
+      if (instance_buffer_base_ptr)
+        return instance_buffer_base_ptr;
+      if (packed_vertex_buffer_base_ptr)
+        return packed_vertex_buffer_base_ptr;
+      return vertex_buffer_base_ptr;
+    }
+
+    /// This function reallocates the batch data (CPU and GPU) for new capacity. Pipeline, shader, white texture and index buffer (if big
+    /// enough) are kept. NOTE: To be called only when batch is empty
+    /// - Parameter max_elements: new max quads in single batch
+    void Resize(uint32_t max_elements) {
+      SetCapacity(max_elements);
+      if (shape_vertex_buffer_base_ptr) {
+        delete [] shape_vertex_buffer_base_ptr;
+        shape_vertex_buffer_base_ptr = new ShapeVertex[max_vertices];
+      }
+      else if (instance_buffer_base_ptr) {
+        delete [] instance_buffer_base_ptr;
+        instance_buffer_base_ptr = new Instance[max_element];
+      }
+      else if (packed_vertex_buffer_base_ptr) {
+        delete [] packed_vertex_buffer_base_ptr;
+        packed_vertex_buffer_base_ptr = new PackedVertex[max_vertices];
+      }
+      else {
+        delete [] vertex_buffer_base_ptr;
+        vertex_buffer_base_ptr = new Vertex[max_vertices];
+      }
+      vertex_buffer->Resize((instanced ? max_element : max_vertices) * vertex_size);
+      RendererStatistics::Get().stats_2d_.max_quads = max_element;
+      StartBatch();
     }
 
     virtual ~QuadData() {
       delete [] vertex_buffer_base_ptr;
       vertex_buffer_base_ptr = nullptr;
+      delete [] packed_vertex_buffer_base_ptr;
+      packed_vertex_buffer_base_ptr = nullptr;
+      delete [] instance_buffer_base_ptr;
+      instance_buffer_base_ptr = nullptr;
+      delete [] shape_vertex_buffer_base_ptr;
+      shape_vertex_buffer_base_ptr = nullptr;
+      unit_quad_buffer.reset();
     }
   };
   static std::unique_ptr<QuadData> quad_data_;
@@ -193,24 +526,71 @@ namespace ikan {
       
       int32_t pixel_id;
     };
+    /// Single packed vertex of a Circle
+    struct PackedVertex : CommonPackedVertex {
+      uint32_t local_position;  // Half float x 2 (z is always 0)
+      uint32_t thickness_fade;  // Half float x 2
+      
+      int32_t pixel_id;
+    };
     
     /// Base pointer of Vertex Data. This is start of Batch data for single draw call
     Vertex* vertex_buffer_base_ptr = nullptr;
     /// Incrememntal Vetrtex Data Pointer to store all the batch data in Buffer
     Vertex* vertex_buffer_ptr = nullptr;
     
+    /// Base pointer of Packed Vertex Data. Used only for Packed vertex format
+    PackedVertex* packed_vertex_buffer_base_ptr = nullptr;
+    /// Incrememntal Packed Vetrtex Data Pointer
+    PackedVertex* packed_vertex_buffer_ptr = nullptr;
+    
     void StartBatch(const glm::mat4& cam_view_proj_mat) {
       StartCommonBatch(cam_view_proj_mat);
       StartBatch();
     }
 
     void StartBatch() {
+      StartCommonBatch();
       vertex_buffer_ptr = vertex_buffer_base_ptr;
+      packed_vertex_buffer_ptr = packed_vertex_buffer_base_ptr;
+    }
+    
+    /// This function returns the size of vertex data stored in current batch
+    uint32_t DataSize() const {
+      if (packed_vertex_buffer_base_ptr)
+        return (uint32_t)((uint8_t*)packed_vertex_buffer_ptr - (uint8_t*)packed_vertex_buffer_base_ptr);
+      return (uint32_t)((uint8_t*)vertex_buffer_ptr - (uint8_t*)vertex_buffer_base_ptr);
+    }
+    /// This function returns the base pointer of vertex data
+    void* DataBasePtr() const {
+      if (packed_vertex_buffer_base_ptr)
+        return packed_vertex_buffer_base_ptr;
+      return vertex_buffer_base_ptr;
+    }
+
+    /// This function reallocates the batch data (CPU and GPU) for new capacity. Pipeline, shader, white texture and index buffer (if big
+    /// enough) are kept. NOTE: To be called only when batch is empty
+    /// - Parameter max_elements: new max circles in single batch
+    void Resize(uint32_t max_elements) {
+      SetCapacity(max_elements);
+      if (packed_vertex_buffer_base_ptr) {
+        delete [] packed_vertex_buffer_base_ptr;
+        packed_vertex_buffer_base_ptr = new PackedVertex[max_vertices];
+      }
+      else {
+        delete [] vertex_buffer_base_ptr;
+        vertex_buffer_base_ptr = new Vertex[max_vertices];
+      }
+      vertex_buffer->Resize(max_vertices * vertex_size);
+      RendererStatistics::Get().stats_2d_.max_circles = max_element;
+      StartBatch();
     }
 
     virtual ~CircleData() {
       delete [] vertex_buffer_base_ptr;
       vertex_buffer_base_ptr = nullptr;
+      delete [] packed_vertex_buffer_base_ptr;
+      packed_vertex_buffer_base_ptr = nullptr;
     }
   };
   static std::unique_ptr<CircleData> circle_data_;
@@ -245,6 +625,19 @@ namespace ikan {
     void Initialise(uint32_t max_elements) {
       CommonInit(max_elements, VertexForSingleLine);
     }
+    
+    /// This function reallocates the batch data (CPU and GPU) for new capacity. NOTE: To be called only when batch is empty
+    /// - Parameter max_elements: new max lines in single batch
+    void Resize(uint32_t max_elements) {
+      max_element = max_elements;
+      max_vertices = max_elements * VertexForSingleLine;
+      
+      delete [] vertex_buffer_base_ptr;
+      vertex_buffer_base_ptr = new Vertex[max_vertices];
+      vertex_buffer->Resize(max_vertices * sizeof(Vertex));
+      RendererStatistics::Get().stats_2d_.max_lines = max_element;
+      StartBatch();
+    }
 
     virtual ~LineData() {
       delete [] vertex_buffer_base_ptr;
@@ -253,8 +646,9 @@ namespace ikan {
   };
   static std::unique_ptr<LineData> line_data_;
   
-  void Batch2DRenderer::Initialise(uint32_t max_quads, uint32_t max_cirlces, uint32_t max_lines) {
+  void Batch2DRenderer::Initialise(uint32_t max_quads, uint32_t max_cirlces, uint32_t max_lines, VertexFormat vertex_format) {
     IK_CORE_TRACE(LogModule::Batch2DRenderer, "Initialising the Batch Renderer 2D ...");
+    vertex_format_ = vertex_format;
     
     AddQuadData(max_quads);
     AddCircleData(max_cirlces);
@@ -268,7 +662,7 @@ namespace ikan {
       BATCH_TRACE("Destroying the Batch Renderer Quad Data");
       BATCH_TRACE("  Max Quads per Batch            {0}", quad_data_->max_element);
       BATCH_TRACE("  Max Texture Slots per Batch    {0}", MaxTextureSlotsInShader);
-      BATCH_TRACE("  Vertex Buffer used             {0} B", quad_data_->max_vertices * sizeof(QuadData::Vertex));
+      BATCH_TRACE("  Vertex Buffer used             {0} B", quad_data_->vertex_buffer->GetSize());
       BATCH_TRACE("  Index Buffer used              {0} B", quad_data_->max_indices * sizeof(uint32_t));
       BATCH_TRACE("  Shader Used                    {0}", quad_data_->shader->GetName());
       quad_data_.reset();
@@ -278,7 +672,7 @@ namespace ikan {
       BATCH_TRACE("Destroying the Batch Renderer Circle Data");
       BATCH_TRACE("  Max Circles per Batch          {0}", circle_data_->max_element);
       BATCH_TRACE("  Max Texture Slots per Batch    {0}", MaxTextureSlotsInShader);
-      BATCH_TRACE("  Vertex Buffer used             {0}", circle_data_->max_vertices * sizeof(CircleData::Vertex));
+      BATCH_TRACE("  Vertex Buffer used             {0}", circle_data_->vertex_buffer->GetSize());
       BATCH_TRACE("  Vertex Buffer used             {0}", circle_data_->max_indices * sizeof(uint32_t));
       BATCH_TRACE("  Shader used                    {0}", circle_data_->shader->GetName());
       circle_data_.reset();
@@ -296,10 +690,13 @@ namespace ikan {
     RETURN_IF(max_element == 0);
     std::unique_ptr<QuadData>& data = quad_data_;
     
-    // If data have already created then append the data to previous one
+    // If data have already created then reserve more capacity in same data (Pipeline, shader and textures are kept)
     if (data) {
-      max_element += data->max_element;
-      data.reset();
+      data->min_element += max_element;
+      if (data->min_element > data->max_element)
+        data->Resize(data->min_element);
+      BATCH_TRACE("Reserved Batch Renderer Quad Data for {0} Quads per Batch", data->max_element);
+      return;
     }
   
     // Allocate memory for Quad Data
@@ -308,42 +705,127 @@ namespace ikan {
     // Initialize the data for Common shape
     data->Initialise(max_element);
 
-    // Allocating the memory for vertex Buffer Pointer
-    data->vertex_buffer_base_ptr = new QuadData::Vertex[data->max_vertices];
-    
-    // Create vertes Buffer
-    data->vertex_buffer = VertexBuffer::Create(data->max_vertices * sizeof(QuadData::Vertex));
-    data->vertex_buffer->AddLayout({
-      { "a_Position",     ShaderDataType::Float3 },
-      { "a_Color",        ShaderDataType::Float4 },
-      { "a_TexCoords",    ShaderDataType::Float2 },
-      { "a_TexIndex",     ShaderDataType::Float },
-      { "a_TilingFactor", ShaderDataType::Float },
-      { "a_ObjectID",     ShaderDataType::Int },
-    });
-    data->pipeline->AddVertexBuffer(data->vertex_buffer);
-        
-    // Setup the Quad Shader
-    data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_quad_shader.glsl"));
+    if (vertex_format_ == VertexFormat::Unified) {
+      // Allocating the memory for shape vertex Buffer Pointer
+      data->vertex_size = sizeof(QuadData::ShapeVertex);
+      data->shape_vertex_buffer_base_ptr = new QuadData::ShapeVertex[data->max_vertices];
+      
+      // Create vertes Buffer
+      data->vertex_buffer = VertexBuffer::Create(data->max_vertices * data->vertex_size);
+      data->vertex_buffer->AddLayout({
+        { "a_Position",      ShaderDataType::Float3 },
+        { "a_Color",         ShaderDataType::Float4 },
+        { "a_TexCoords",     ShaderDataType::Float2 },
+        { "a_TexIndex",      ShaderDataType::Float },
+        { "a_TilingFactor",  ShaderDataType::Float },
+        { "a_LocalPosition", ShaderDataType::Float2 },
+        { "a_HalfSize",      ShaderDataType::Float2 },
+        { "a_Shape",         ShaderDataType::Float3 },
+        { "a_ObjectID",      ShaderDataType::Int },
+      });
+      data->pipeline->AddVertexBuffer(data->vertex_buffer);
+      
+      // Setup the Shape Shader
+      data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_shape_shader.glsl"));
+    }
+    else if (vertex_format_ == VertexFormat::Instanced) {
+      // Allocating the memory for instance Buffer Pointer (one instance per quad)
+      data->instanced = true;
+      data->vertex_size = sizeof(QuadData::Instance);
+      data->instance_buffer_base_ptr = new QuadData::Instance[data->max_element];
+      
+      // Create static buffer of unit quad corners (in the order of base vertex positions). Corner is also used to pick uv from rect
+      float unit_quad_corners[] = {
+        0.0f, 0.0f,   1.0f, 0.0f,   1.0f, 1.0f,   0.0f, 1.0f
+      };
+      data->unit_quad_buffer = VertexBuffer::Create(unit_quad_corners, sizeof(unit_quad_corners));
+      data->unit_quad_buffer->AddLayout({
+        { "a_Corner",       ShaderDataType::Float2 },
+      });
+      data->pipeline->AddVertexBuffer(data->unit_quad_buffer);
+      
+      // Create instance Buffer
+      data->vertex_buffer = VertexBuffer::Create(data->max_element * data->vertex_size);
+      data->vertex_buffer->AddLayout({
+        { "a_Affine",       ShaderDataType::Float4, false, 1 /* divisor */ },
+        { "a_Translation",  ShaderDataType::Float3, false, 1 /* divisor */ },
+        { "a_UVRect",       ShaderDataType::Float4, false, 1 /* divisor */ },
+        { "a_Color",        ShaderDataType::UByte4, true,  1 /* divisor */ },
+        { "a_TexIndex",     ShaderDataType::UByte4, false, 1 /* divisor */ },
+        { "a_ObjectID",     ShaderDataType::Int,    false, 1 /* divisor */ },
+      });
+      data->pipeline->AddVertexBuffer(data->vertex_buffer);
+      
+      // Setup the Quad Shader
+      data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_quad_instanced_shader.glsl"));
+    }
+    else if (vertex_format_ == VertexFormat::Packed) {
+      // Allocating the memory for vertex Buffer Pointer
+      data->vertex_size = sizeof(QuadData::PackedVertex);
+      data->packed_vertex_buffer_base_ptr = new QuadData::PackedVertex[data->max_vertices];
+      
+      // Create vertes Buffer
+      data->vertex_buffer = VertexBuffer::Create(data->max_vertices * data->vertex_size);
+      data->vertex_buffer->AddLayout({
+        { "a_Position",     ShaderDataType::Float3 },
+        { "a_Color",        ShaderDataType::UByte4, true /* normalized */ },
+        { "a_TexCoords",    ShaderDataType::Half2 },
+        { "a_TexIndex",     ShaderDataType::UByte4 },
+        { "a_ObjectID",     ShaderDataType::Int },
+      });
+      data->pipeline->AddVertexBuffer(data->vertex_buffer);
+      
+      // Setup the Quad Shader
+      data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_quad_packed_shader.glsl"));
+    }
+    else {
+      // Allocating the memory for vertex Buffer Pointer
+      data->vertex_size = sizeof(QuadData::Vertex);
+      data->vertex_buffer_base_ptr = new QuadData::Vertex[data->max_vertices];
+      
+      // Create vertes Buffer
+      data->vertex_buffer = VertexBuffer::Create(data->max_vertices * data->vertex_size);
+      data->vertex_buffer->AddLayout({
+        { "a_Position",     ShaderDataType::Float3 },
+        { "a_Color",        ShaderDataType::Float4 },
+        { "a_TexCoords",    ShaderDataType::Float2 },
+        { "a_TexIndex",     ShaderDataType::Float },
+        { "a_TilingFactor", ShaderDataType::Float },
+        { "a_ObjectID",     ShaderDataType::Int },
+      });
+      data->pipeline->AddVertexBuffer(data->vertex_buffer);
+      
+      // Setup the Quad Shader
+      data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_quad_shader.glsl"));
+    }
     
     RendererStatistics::Get().stats_2d_.max_quads = data->max_element;
     
     BATCH_TRACE("Initialized Batch Renderer for Quad Data");
     BATCH_TRACE("  Max Quads per Batch              {0}", data->max_element);
     BATCH_TRACE("  Max Texture Slots per Batch      {0}", MaxTextureSlotsInShader);
-    BATCH_TRACE("  Vertex Buffer used               {0} B", data->max_vertices * sizeof(QuadData::Vertex));
+    BATCH_TRACE("  Vertex Buffer used               {0} B", data->vertex_buffer->GetSize());
     BATCH_TRACE("  Index Buffer used                {0} B", data->max_indices * sizeof(uint32_t));
     BATCH_TRACE("  Shader Used                      {0}", data->shader->GetName());
   }
   
   void Batch2DRenderer::AddCircleData(uint32_t max_element) {
     RETURN_IF(max_element == 0);
+    // Circles are rendered in the quad batch with Unified vertex format
+    if (vertex_format_ == VertexFormat::Unified) {
+      AddQuadData(max_element);
+      return;
+    }
+    
     std::unique_ptr<CircleData>& data = circle_data_;
     
-    // If data have already created then append the data to previous one
+    // If data have already created then reserve more capacity in same data (Pipeline, shader and textures are kept)
     if (data) {
-      max_element += data->max_element;
-      data.reset();
+      data->min_element += max_element;
+      if (data->min_element > data->max_element)
+        data->Resize(data->min_element);
+      BATCH_TRACE("Reserved Batch Renderer Circle Data for {0} Circles per Batch", data->max_element);
+      return;
     }
 
     // Allocate memory for Circle Data
@@ -352,33 +834,57 @@ namespace ikan {
     // Initialize the data for Common shape
     data->Initialise(max_element);
     
-    // Allocating the memory for vertex Buffer Pointer
-    data->vertex_buffer_base_ptr = new CircleData::Vertex[data->max_vertices];
-    
-    // Create vertes Buffer
-    data->vertex_buffer = VertexBuffer::Create(data->max_vertices * sizeof(CircleData::Vertex));
-    data->vertex_buffer->AddLayout({
-      { "a_Position",     ShaderDataType::Float3 },
-      { "a_Color",        ShaderDataType::Float4 },
-      { "a_TexCoords",    ShaderDataType::Float2 },
-      { "a_TexIndex",     ShaderDataType::Float },
-      { "a_TilingFactor", ShaderDataType::Float },
-      { "a_LocalPosition",ShaderDataType::Float3 },
-      { "a_Thickness",    ShaderDataType::Float },
-      { "a_Fade",         ShaderDataType::Float },
-      { "a_ObjectID",     ShaderDataType::Int },
-    });
-    data->pipeline->AddVertexBuffer(data->vertex_buffer);
-    
-    // Setup the Quad Shader
-    data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_circle_shader.glsl"));
+    if (vertex_format_ == VertexFormat::Packed) {
+      // Allocating the memory for vertex Buffer Pointer
+      data->vertex_size = sizeof(CircleData::PackedVertex);
+      data->packed_vertex_buffer_base_ptr = new CircleData::PackedVertex[data->max_vertices];
+      
+      // Create vertes Buffer
+      data->vertex_buffer = VertexBuffer::Create(data->max_vertices * data->vertex_size);
+      data->vertex_buffer->AddLayout({
+        { "a_Position",      ShaderDataType::Float3 },
+        { "a_Color",         ShaderDataType::UByte4, true /* normalized */ },
+        { "a_TexCoords",     ShaderDataType::Half2 },
+        { "a_TexIndex",      ShaderDataType::UByte4 },
+        { "a_LocalPosition", ShaderDataType::Half2 },
+        { "a_ThicknessFade", ShaderDataType::Half2 },
+        { "a_ObjectID",      ShaderDataType::Int },
+      });
+      data->pipeline->AddVertexBuffer(data->vertex_buffer);
+      
+      // Setup the Circle Shader
+      data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_circle_packed_shader.glsl"));
+    }
+    else {
+      // Allocating the memory for vertex Buffer Pointer
+      data->vertex_size = sizeof(CircleData::Vertex);
+      data->vertex_buffer_base_ptr = new CircleData::Vertex[data->max_vertices];
+      
+      // Create vertes Buffer
+      data->vertex_buffer = VertexBuffer::Create(data->max_vertices * data->vertex_size);
+      data->vertex_buffer->AddLayout({
+        { "a_Position",     ShaderDataType::Float3 },
+        { "a_Color",        ShaderDataType::Float4 },
+        { "a_TexCoords",    ShaderDataType::Float2 },
+        { "a_TexIndex",     ShaderDataType::Float },
+        { "a_TilingFactor", ShaderDataType::Float },
+        { "a_LocalPosition",ShaderDataType::Float3 },
+        { "a_Thickness",    ShaderDataType::Float },
+        { "a_Fade",         ShaderDataType::Float },
+        { "a_ObjectID",     ShaderDataType::Int },
+      });
+      data->pipeline->AddVertexBuffer(data->vertex_buffer);
+      
+      // Setup the Circle Shader
+      data->shader = Renderer::GetShader(DM::CoreAsset("shaders/batch_circle_shader.glsl"));
+    }
     
     RendererStatistics::Get().stats_2d_.max_circles = data->max_element;
     
     BATCH_TRACE("Initialized Batch Renderer for Circle Data");
     BATCH_TRACE("  Max Circles per Batch            {0}", data->max_element);
     BATCH_TRACE("  Max Texture Slots per Batch      {0}", MaxTextureSlotsInShader);
-    BATCH_TRACE("  Vertex Buffer used               {0} B", data->max_vertices * sizeof(CircleData::Vertex));
+    BATCH_TRACE("  Vertex Buffer used               {0} B", data->vertex_buffer->GetSize());
     BATCH_TRACE("  Index Buffer used                {0} B", data->max_indices * sizeof(uint32_t));
     BATCH_TRACE("  Shader Used                      {0}", data->shader->GetName());
   }
@@ -387,10 +893,13 @@ namespace ikan {
     RETURN_IF(max_element == 0);
     std::unique_ptr<LineData>& data = line_data_;
     
-    // If data have already created then append the data to previous one
+    // If data have already created then reserve more capacity in same data (Pipeline, shader and textures are kept)
     if (data) {
-      max_element += data->max_element;
-      data.reset();
+      data->min_element += max_element;
+      if (data->min_element > data->max_element)
+        data->Resize(data->min_element);
+      BATCH_TRACE("Reserved Batch Renderer Line Data for {0} Lines per Batch", data->max_element);
+      return;
     }
 
     // Allocate memory for Line Data
@@ -421,6 +930,10 @@ namespace ikan {
     BATCH_TRACE("  Shader Used                      {0}", data->shader->GetName());
   }
   
+  Batch2DRenderer::VertexFormat Batch2DRenderer::GetVertexFormat() {
+    return vertex_format_;
+  }
+
   void Batch2DRenderer::LogData() {
     BATCH_INFO("    Batch Renderer Data ...");
 
@@ -428,24 +941,69 @@ namespace ikan {
 
     BATCH_INFO("            Max Texture slots             | {0}", MaxTextureSlotsInShader);
     BATCH_INFO("            Max Quads                     | {0}", quad_data_->max_element);
-    BATCH_INFO("            Max Circles                   | {0}", circle_data_->max_element);
+    if (circle_data_)
+      BATCH_INFO("            Max Circles                   | {0}", circle_data_->max_element);
     BATCH_INFO("            Max Lines                     | {0}", line_data_->max_element);
     
     BATCH_INFO("        GPU Memory");
-    [[maybe_unused]] uint32_t vertex_buffer_size = quad_data_->max_vertices * sizeof(QuadData::Vertex);
-    vertex_buffer_size += circle_data_->max_vertices * sizeof(CircleData::Vertex);
+    [[maybe_unused]] uint32_t vertex_buffer_size = quad_data_->vertex_buffer->GetSize();
+    if (circle_data_)
+      vertex_buffer_size += circle_data_->vertex_buffer->GetSize();
     vertex_buffer_size += line_data_->max_vertices * sizeof(LineData::Vertex);
     BATCH_INFO("            Vertex Buffer used            | {0} Bytes", vertex_buffer_size);
 
-    [[maybe_unused]] uint32_t index_buffer_size = (quad_data_->max_indices + circle_data_->max_indices) * sizeof(uint32_t);
+    [[maybe_unused]] uint32_t index_buffer_size = (quad_data_->max_indices + (circle_data_ ? circle_data_->max_indices : 0)) * sizeof(uint32_t);
     BATCH_INFO("            Index Buffer used             | {0} Bytes", index_buffer_size);
     
     BATCH_INFO("        Shaders");
     BATCH_INFO("            Quad                          | {0}", quad_data_->shader->GetName());
-    BATCH_INFO("            Circle                        | {0}", circle_data_->shader->GetName());
+    if (circle_data_)
+      BATCH_INFO("            Circle                        | {0}", circle_data_->shader->GetName());
     BATCH_INFO("            Line                          | {0}", line_data_->shader->GetName());
   }
 
+  /// This function updates the capacity of batch data from the flushes of previous frame. To be called at frame boundary (batch is empty)
+  /// - Parameters:
+  ///   - data: batch data of shape
+  ///   - name: name of shape for logs
+  template<typename BatchData>
+  static void AdaptBatchCapacity(BatchData& data, [[maybe_unused]] const char* name) {
+    uint32_t capacity = data.NextCapacity();
+    RETURN_IF(capacity == data.max_element);
+    
+    BATCH_INFO("Resizing the {0} batch from {1} to {2} elements (based on observed peaks)", name, data.max_element, capacity);
+    data.Resize(capacity);
+  }
+
+#ifdef IK_DEBUG_FEATURE
+  /// This function checks that each element submitted in previous frame is flushed exactly once, so that capacity is adapted from
+  /// real counts. To be called before the batch data of frame is reset
+  /// - Parameters:
+  ///   - data: batch data of shape
+  ///   - submitted: number of elements submitted in previous frame (from renderer stats)
+  ///   - name: name of shape for logs
+  template<typename BatchData>
+  static void ValidateFlushedElements(const BatchData& data, uint32_t submitted, const char* name) {
+    if (data.frame_elements != submitted)
+      IK_CORE_WARN(LogModule::Batch2DRenderer, "{0} batch flushed {1} elements but {2} are submitted in previous frame", name,
+                   data.frame_elements, submitted);
+  }
+#endif
+
+  void Batch2DRenderer::AdaptCapacity() {
+#ifdef IK_DEBUG_FEATURE
+    // Circles are rendered in quad batch when there is no separate circle batch (Unified vertex format)
+    const auto& stats = RendererStatistics::Get().stats_2d_;
+    if (quad_data_) ValidateFlushedElements(*quad_data_, stats.quads + (circle_data_ ? 0 : stats.circles), "Quad");
+    if (circle_data_) ValidateFlushedElements(*circle_data_, stats.circles, "Circle");
+    if (line_data_) ValidateFlushedElements(*line_data_, stats.lines, "Line");
+#endif
+    
+    if (quad_data_) AdaptBatchCapacity(*quad_data_, "Quad");
+    if (circle_data_) AdaptBatchCapacity(*circle_data_, "Circle");
+    if (line_data_) AdaptBatchCapacity(*line_data_, "Line");
+  }
+
   void Batch2DRenderer::BeginBatch(const glm::mat4& cam_view_proj_mat) {
     if (quad_data_) quad_data_->StartBatch(cam_view_proj_mat);
     if (circle_data_) circle_data_->StartBatch(cam_view_proj_mat);
@@ -463,26 +1021,34 @@ namespace ikan {
   }
   
   void Batch2DRenderer::Flush() {
-    if (quad_data_ and quad_data_->index_count) {
-      uint32_t data_size = (uint32_t)((uint8_t*)quad_data_->vertex_buffer_ptr - (uint8_t*)quad_data_->vertex_buffer_base_ptr);
-      quad_data_->vertex_buffer->SetData(quad_data_->vertex_buffer_base_ptr, data_size);
-      quad_data_->Flush();
-    }
-    
-    if (circle_data_ and circle_data_->index_count) {
-      uint32_t dataSize = (uint32_t)((uint8_t*)circle_data_->vertex_buffer_ptr - (uint8_t*)circle_data_->vertex_buffer_base_ptr);
-      circle_data_->vertex_buffer->SetData(circle_data_->vertex_buffer_base_ptr, dataSize);
-      circle_data_->Flush();
-    }
+    FlushQuadBatch();
+    FlushCircleBatch();
+    FlushLineBatch();
+  }
+  
+  void Batch2DRenderer::FlushQuadBatch() {
+    RETURN_IF(!quad_data_ or !quad_data_->index_count);
+    quad_data_->vertex_buffer->SetData(quad_data_->DataBasePtr(), quad_data_->DataSize());
+    quad_data_->Flush();
+    quad_data_->RecordFlush(quad_data_->index_count / Shape2DCommonData::IndicesForSingleElement);
+  }
+  
+  void Batch2DRenderer::FlushCircleBatch() {
+    RETURN_IF(!circle_data_ or !circle_data_->index_count);
+    circle_data_->vertex_buffer->SetData(circle_data_->DataBasePtr(), circle_data_->DataSize());
+    circle_data_->Flush();
+    circle_data_->RecordFlush(circle_data_->index_count / Shape2DCommonData::IndicesForSingleElement);
+  }
+  
+  void Batch2DRenderer::FlushLineBatch() {
+    RETURN_IF(!line_data_ or !line_data_->vertex_count);
+    line_data_->RecordFlush(line_data_->vertex_count / LineData::VertexForSingleLine);
+    uint32_t dataSize = (uint32_t)((uint8_t*)line_data_->vertex_buffer_ptr - (uint8_t*)line_data_->vertex_buffer_base_ptr);
+    line_data_->vertex_buffer->SetData(line_data_->vertex_buffer_base_ptr, dataSize);
     
-    if (line_data_ and line_data_->vertex_count) {
-      uint32_t dataSize = (uint32_t)((uint8_t*)line_data_->vertex_buffer_ptr - (uint8_t*)line_data_->vertex_buffer_base_ptr);
-      line_data_->vertex_buffer->SetData(line_data_->vertex_buffer_base_ptr, dataSize);
-      
-      line_data_->shader->Bind();      
-      // Render the Scene
-      Renderer::DrawLines(line_data_->pipeline, line_data_->vertex_count);
-    }
+    line_data_->shader->Bind();
+    // Render the Scene
+    Renderer::DrawLines(line_data_->pipeline, line_data_->vertex_count);
   }
   
   void Batch2DRenderer::DrawQuad(const glm::mat4& transform, const glm::vec4& color, int32_t object_id) {
@@ -493,71 +1059,357 @@ namespace ikan {
     auto transform  = Math::GetTransformMatrix(position, rotation, scale);
     DrawTextureQuad(transform, nullptr, texture_coords_, 1.0f /* tiling factor */, color, object_id);
   }
-  void Batch2DRenderer::DrawQuad(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, const glm::vec4& tint_color,
+  void Batch2DRenderer::DrawQuad(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color,
                                  float tiling_factor, int32_t object_id) {
-    DrawTextureQuad(transform, texture ? texture : nullptr, texture_coords_, tiling_factor, tint_color, object_id );
+    DrawTextureQuad(transform, texture.Get(), texture_coords_, tiling_factor, tint_color, object_id );
   }
   void Batch2DRenderer::DrawQuad(const glm::mat4& transform, const std::shared_ptr<SubTexture>& sub_texture, const glm::vec4& tint_color,
                                int32_t object_id) {
     const glm::vec2* texture_coords = sub_texture->GetTexCoord();
-    DrawTextureQuad(transform, (sub_texture) ? sub_texture->GetSpriteImage() : nullptr, (sub_texture) ? texture_coords : texture_coords_,
+    DrawTextureQuad(transform, (sub_texture) ? sub_texture->GetSpriteHandle().Get() : nullptr, (sub_texture) ? texture_coords : texture_coords_,
                     1.0f, tint_color, object_id);
   }
+  void Batch2DRenderer::DrawQuad(const glm::mat4& transform, const SpriteSheet& sprite_sheet, SpriteSheet::FrameID frame,
+                                 const glm::vec4& tint_color, int32_t object_id) {
+    const glm::vec4& uv_rect = sprite_sheet.GetFrameUV(frame);
+    const glm::vec2 texture_coords[4] = { { uv_rect.x, uv_rect.y }, { uv_rect.z, uv_rect.y }, { uv_rect.z, uv_rect.w }, { uv_rect.x, uv_rect.w } };
+    DrawTextureQuad(transform, sprite_sheet.GetTextureHandle().Get(), texture_coords, 1.0f, tint_color, object_id);
+  }
   
-  void Batch2DRenderer::DrawTextureQuad(const glm::mat4& transform, const std::shared_ptr<Texture>& texture,
+  void Batch2DRenderer::DrawTextureQuad(const glm::mat4& transform, const Texture* texture,
                                         const glm::vec2* texture_coords, float tiling_factor, const glm::vec4& tint_color, int32_t object_id) {
     // If number of indices increase in batch then start new batch
     if (quad_data_->index_count >= quad_data_->max_indices) {
       BATCH_INFO("Starts the new batch as number of indices ({0}) increases in the previous batch", quad_data_->index_count);
-      EndBatch();
+      FlushQuadBatch();
       quad_data_->StartBatch();
     }
     
-    float texture_index = 0.0f;
-    if (texture) {
-      // Find if texture is already loaded in current batch
-      for (size_t i = 1; i < quad_data_->texture_slot_index; i++) {
-        if (quad_data_->texture_slots[i].get() == texture.get()) {
-          // Found the current textue in the batch
-          texture_index = (float)i;
-          break;
-        }
+    float texture_index = (float)GetQuadTextureSlot(texture);
+    
+    if (quad_data_->shape_vertex_buffer_base_ptr) {
+      quad_data_->AddShape(transform, texture_coords, tiling_factor, tint_color, texture_index, ShapeKind::Quad, 0.0f, 0.0f, object_id);
+    }
+    else if (quad_data_->instance_buffer_base_ptr) {
+      glm::vec4 affine = { transform[0][0], transform[0][1], transform[1][0], transform[1][1] };
+      glm::vec4 uv_rect = { texture_coords[0] * tiling_factor, texture_coords[2] * tiling_factor };
+      quad_data_->AddInstance(affine, glm::vec3(transform[3]), uv_rect, tint_color, (uint32_t)texture_index, object_id);
+    }
+    else if (quad_data_->packed_vertex_buffer_base_ptr) {
+      uint32_t packed_color = glm::packUnorm4x8(tint_color);
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        quad_data_->packed_vertex_buffer_ptr->position        = transform * quad_data_->vertex_base_position[i];
+        quad_data_->packed_vertex_buffer_ptr->color           = packed_color;
+        quad_data_->packed_vertex_buffer_ptr->texture_coords  = glm::packHalf2x16(texture_coords[i] * tiling_factor);
+        quad_data_->packed_vertex_buffer_ptr->texture_index   = (uint32_t)texture_index;
+        quad_data_->packed_vertex_buffer_ptr->pixel_id        = object_id;
+        quad_data_->packed_vertex_buffer_ptr++;
       }
-      
-      // If current texture slot is not pre loaded then load the texture in proper slot
-      if (texture_index == 0.0f) {
-        // If number of slots increases max then start new batch
-        if (quad_data_->texture_slot_index >= MaxTextureSlotsInShader) {
+    }
+    else {
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        quad_data_->vertex_buffer_ptr->position         = transform * quad_data_->vertex_base_position[i];
+        quad_data_->vertex_buffer_ptr->color            = tint_color;
+        quad_data_->vertex_buffer_ptr->texture_coords   = texture_coords[i];
+        quad_data_->vertex_buffer_ptr->texture_index    = texture_index;
+        quad_data_->vertex_buffer_ptr->tiling_factor    = tiling_factor;
+        quad_data_->vertex_buffer_ptr->pixel_id         = object_id;
+        quad_data_->vertex_buffer_ptr++;
+      }
+    }
+    
+    quad_data_->index_count += Shape2DCommonData::IndicesForSingleElement;
+    
+    RendererStatistics::Get().index_count += Shape2DCommonData::IndicesForSingleElement;
+    RendererStatistics::Get().vertex_count += Shape2DCommonData::VertexForSingleElement;
+    
+    RendererStatistics::Get().stats_2d_.quads ++;
+  }
+  
+  uint32_t Batch2DRenderer::GetQuadTextureSlot(const Texture* texture) {
+    if (!texture)
+      return 0;
+    
+    // Find if texture is already loaded in current batch
+    RendererID renderer_id = texture->GetRendererID();
+    uint32_t slot = quad_data_->FindTextureSlot(renderer_id);
+    
+    // If current texture slot is not pre loaded then load the texture in proper slot
+    if (slot == 0) {
+      // If number of slots increases max then start new batch
+      if (quad_data_->texture_slot_index >= MaxTextureSlotsInShader) {
 #if 0
-          BATCH_INFO("Starts the new batch as number of texture slot ({0}) increases in the previous batch", quad_data_->texture_slot_index);
+        BATCH_INFO("Starts the new batch as number of texture slot ({0}) increases in the previous batch", quad_data_->texture_slot_index);
 #endif
-          EndBatch();
-          quad_data_->StartBatch();
+        FlushQuadBatch();
+        quad_data_->StartBatch();
+      }
+      
+      // Loading the current texture in the first free slot slot
+      slot = quad_data_->AddTextureSlot(texture, renderer_id);
+    }
+    return slot;
+  }
+  
+  /// This function writes the data of single quad (4 vertices or 1 instance) at destination in the vertex format of quad batch
+  /// - Parameters:
+  ///   - dst: destination of quad data
+  ///   - quads: bulk quads
+  ///   - quad_idx: index of quad in bulk
+  ///   - texture_index: texture slot of quad
+  ///   - bulk_x: x of 4 corners generated by WriteBulkQuads, if quad is given with position and half extent (not instanced)
+  ///   - bulk_y: y of 4 corners generated by WriteBulkQuads, if quad is given with position and half extent (not instanced)
+  static void WriteBulkQuad(uint8_t* dst, const Batch2DRenderer::Quads2D& quads, size_t quad_idx, uint32_t texture_index,
+                            const float* bulk_x, const float* bulk_y) {
+    const glm::vec4& color = quads.colors.empty() ? glm::vec4(1.0f) : quads.colors[quad_idx];
+    const glm::vec4& uv = quads.uv_rects.empty() ? glm::vec4(0.0f, 0.0f, 1.0f, 1.0f) : quads.uv_rects[quad_idx];
+    const glm::vec2 texture_coords[4] = { {uv.x, uv.y}, {uv.z, uv.y}, {uv.z, uv.w}, {uv.x, uv.w} };
+    const int32_t object_id = quads.object_ids.empty() ? -1 : quads.object_ids[quad_idx];
+    
+    // Generate the corners of quad (or axes of quad for instance)
+    glm::vec4 affine;
+    glm::vec3 translation;
+    float corner_x[4], corner_y[4], corner_z[4];
+    if (!quads.transforms.empty()) {
+      const glm::mat4& transform = quads.transforms[quad_idx];
+      affine = { transform[0][0], transform[0][1], transform[1][0], transform[1][1] };
+      translation = transform[3];
+      if (!quad_data_->instanced) {
+        for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+          glm::vec4 position = transform * quad_data_->vertex_base_position[i];
+          corner_x[i] = position.x;
+          corner_y[i] = position.y;
+          corner_z[i] = position.z;
+        }
+      }
+    }
+    else {
+      translation = quads.positions[quad_idx];
+      if (quad_data_->instanced) {
+        const glm::vec2& half_extent = quads.half_extents[quad_idx];
+        const float rotation = quads.rotations.empty() ? 0.0f : quads.rotations[quad_idx];
+        const float cos_rotation = std::cos(rotation), sin_rotation = std::sin(rotation);
+        affine = {
+          2.0f * half_extent.x * cos_rotation, 2.0f * half_extent.x * sin_rotation,
+          -2.0f * half_extent.y * sin_rotation, 2.0f * half_extent.y * cos_rotation
+        };
+      }
+      else {
+        std::copy_n(bulk_x, 4, corner_x);
+        std::copy_n(bulk_y, 4, corner_y);
+        std::fill_n(corner_z, 4, translation.z);
+      }
+    }
+    
+    if (quad_data_->shape_vertex_buffer_base_ptr) {
+      QuadData::ShapeVertex* vertex = (QuadData::ShapeVertex*)dst;
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        vertex->position         = { corner_x[i], corner_y[i], corner_z[i] };
+        vertex->color            = color;
+        vertex->texture_coords   = texture_coords[i];
+        vertex->texture_index    = (float)texture_index;
+        vertex->tiling_factor    = 1.0f;
+        vertex->local_position   = { 0.0f, 0.0f };
+        vertex->half_size        = { 1.0f, 1.0f };
+        vertex->shape            = { (float)Batch2DRenderer::ShapeKind::Quad, 0.0f, 0.0f };
+        vertex->pixel_id         = object_id;
+        vertex++;
+      }
+    }
+    else if (quad_data_->instance_buffer_base_ptr) {
+      QuadData::Instance* instance = (QuadData::Instance*)dst;
+      instance->affine         = affine;
+      instance->translation    = translation;
+      instance->uv_rect        = uv;
+      instance->color          = glm::packUnorm4x8(color);
+      instance->texture_index  = texture_index;
+      instance->pixel_id       = object_id;
+    }
+    else if (quad_data_->packed_vertex_buffer_base_ptr) {
+      QuadData::PackedVertex* vertex = (QuadData::PackedVertex*)dst;
+      uint32_t packed_color = glm::packUnorm4x8(color);
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        vertex->position        = { corner_x[i], corner_y[i], corner_z[i] };
+        vertex->color           = packed_color;
+        vertex->texture_coords  = glm::packHalf2x16(texture_coords[i]);
+        vertex->texture_index   = texture_index;
+        vertex->pixel_id        = object_id;
+        vertex++;
+      }
+    }
+    else {
+      QuadData::Vertex* vertex = (QuadData::Vertex*)dst;
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        vertex->position         = { corner_x[i], corner_y[i], corner_z[i] };
+        vertex->color            = color;
+        vertex->texture_coords   = texture_coords[i];
+        vertex->texture_index    = (float)texture_index;
+        vertex->tiling_factor    = 1.0f;
+        vertex->pixel_id         = object_id;
+        vertex++;
+      }
+    }
+  }
+  
+  /// This function writes the data of a range of quads at their offset in destination. Corners of quads given with position and
+  /// half extent are generated for blocks of BulkCornerBlock quads at once with Math::GetQuadCorners2DBulk (SIMD across quads)
+  /// - Parameters:
+  ///   - dst: destination of bulk data (offset of first quad of bulk)
+  ///   - quads: bulk quads
+  ///   - first: index of first quad to be written
+  ///   - last: index after the last quad to be written
+  ///   - texture_indices: texture slot of each quad in bulk
+  static void WriteBulkQuads(uint8_t* dst, const Batch2DRenderer::Quads2D& quads, size_t first, size_t last,
+                             const uint8_t* texture_indices) {
+    const uint32_t quad_size = quad_data_->QuadSize();
+    const bool bulk_corners = quads.transforms.empty() and !quad_data_->instanced;
+    const bool rotated = !quads.rotations.empty();
+    
+    float corner_x[BulkCornerBlock * 4], corner_y[BulkCornerBlock * 4];
+    float cos_rotations[BulkCornerBlock], sin_rotations[BulkCornerBlock];
+    for (size_t block = first; block < last; block += BulkCornerBlock) {
+      const size_t block_end = std::min(block + BulkCornerBlock, last);
+      if (bulk_corners) {
+        if (rotated) {
+          for (size_t quad_idx = block; quad_idx < block_end; quad_idx++) {
+            cos_rotations[quad_idx - block] = std::cos(quads.rotations[quad_idx]);
+            sin_rotations[quad_idx - block] = std::sin(quads.rotations[quad_idx]);
+          }
+        }
+        Math::GetQuadCorners2DBulk(block_end - block, &quads.positions[block], &quads.half_extents[block],
+                                   rotated ? cos_rotations : nullptr, rotated ? sin_rotations : nullptr, corner_x, corner_y);
+      }
+      
+      for (size_t quad_idx = block; quad_idx < block_end; quad_idx++) {
+        const size_t corner_idx = (quad_idx - block) * 4;
+        WriteBulkQuad(dst + quad_idx * quad_size, quads, quad_idx, texture_indices[quad_idx], corner_x + corner_idx,
+                      corner_y + corner_idx);
+      }
+    }
+  }
+  
+  void Batch2DRenderer::DrawQuads(const Quads2D& quads) {
+    const bool use_transforms = !quads.transforms.empty();
+    const size_t num_quads = use_transforms ? quads.transforms.size() : quads.positions.size();
+    IK_CORE_ASSERT(use_transforms or quads.half_extents.size() == num_quads, "Half extents should be given for each quad");
+    IK_CORE_ASSERT(quads.rotations.empty() or quads.rotations.size() == num_quads, "Invalid number of rotations");
+    IK_CORE_ASSERT(quads.colors.empty() or quads.colors.size() == num_quads, "Invalid number of colors");
+    IK_CORE_ASSERT(quads.uv_rects.empty() or quads.uv_rects.size() == num_quads, "Invalid number of uv rects");
+    IK_CORE_ASSERT(quads.textures.empty() or quads.textures.size() == num_quads, "Invalid number of textures");
+    IK_CORE_ASSERT(quads.object_ids.empty() or quads.object_ids.size() == num_quads, "Invalid number of object ids");
+    RETURN_IF(num_quads == 0);
+    
+    // ---------------------------------------------------------------------------------------------------------
+    // 1. Plan the batches (serial): Apply the same batch break rule as DrawTextureQuad, starting from the state of
+    //    current batch, and store the texture slot of each quad. Each segment of quads is rendered in one batch
+    // ---------------------------------------------------------------------------------------------------------
+    auto& segments = quad_data_->bulk_segments;
+    segments.clear();
+    
+    auto& texture_indices = quad_data_->bulk_texture_indices;
+    texture_indices.resize(num_quads);
+    
+    std::array<RendererID, MaxTextureSlotsInShader> slot_ids;
+    QuadData::BulkSegment* segment = &segments.emplace_back();
+    segment->first_slot = segment->num_slots = quad_data_->texture_slot_index;
+    for (uint32_t slot = 1; slot < segment->num_slots; slot++)
+      slot_ids[slot] = quad_data_->texture_slots[slot]->GetRendererID();
+    uint32_t elements = quad_data_->index_count / Shape2DCommonData::IndicesForSingleElement;
+    
+    auto start_segment = [&](size_t quad_idx) {
+      segment->end_quad = quad_idx;
+      segment = &segments.emplace_back();
+      segment->first_quad = quad_idx;
+      elements = 0;
+    };
+    
+    for (size_t quad_idx = 0; quad_idx < num_quads; quad_idx++) {
+      if (elements >= quad_data_->max_element)
+        start_segment(quad_idx);
+      
+      uint32_t slot = 0;
+      const Texture* texture = quads.textures.empty() ? nullptr : quads.textures[quad_idx].Get();
+      if (texture) {
+        RendererID renderer_id = texture->GetRendererID();
+        for (uint32_t s = 1; s < segment->num_slots; s++) {
+          if (slot_ids[s] == renderer_id) {
+            slot = s;
+            break;
+          }
         }
         
-        // Loading the current texture in the first free slot slot
-        texture_index = (float)quad_data_->texture_slot_index;
-        quad_data_->texture_slots[quad_data_->texture_slot_index] = texture;
-        quad_data_->texture_slot_index++;
+        if (slot == 0) {
+          if (segment->num_slots >= MaxTextureSlotsInShader)
+            start_segment(quad_idx);
+          
+          slot = segment->num_slots++;
+          slot_ids[slot] = renderer_id;
+          segment->textures[slot] = texture;
+        }
       }
+      
+      texture_indices[quad_idx] = (uint8_t)slot;
+      elements++;
     }
+    segment->end_quad = num_quads;
+    
+    // ---------------------------------------------------------------------------------------------------------
+    // 2. Generate the data of all quads in scratch buffer. For large bulk, workers claim the ranges of quads with
+    //    an atomic cursor and write at the offset of quad, so output is independent of thread scheduling
+    // ---------------------------------------------------------------------------------------------------------
+    const uint32_t quad_size = quad_data_->QuadSize();
+    auto& bulk_vertices = quad_data_->bulk_vertices;
+    bulk_vertices.resize(num_quads * quad_size);
     
-    for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
-      quad_data_->vertex_buffer_ptr->position         = transform * quad_data_->vertex_base_position[i];
-      quad_data_->vertex_buffer_ptr->color            = tint_color;
-      quad_data_->vertex_buffer_ptr->texture_coords   = texture_coords[i];
-      quad_data_->vertex_buffer_ptr->texture_index    = texture_index;
-      quad_data_->vertex_buffer_ptr->tiling_factor    = tiling_factor;
-      quad_data_->vertex_buffer_ptr->pixel_id         = object_id;
-      quad_data_->vertex_buffer_ptr++;
+    if (num_quads < ParallelQuadThreshold) {
+      WriteBulkQuads(bulk_vertices.data(), quads, 0, num_quads, texture_indices.data());
+    }
+    else {
+      std::atomic<size_t> cursor = 0;
+      std::atomic<size_t>* cursor_ptr = &cursor;
+      uint8_t* dst = bulk_vertices.data();
+      const uint8_t* quad_texture_indices = texture_indices.data();
+      const Quads2D* quads_ptr = &quads;
+      
+      size_t num_workers = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), num_quads / ParallelQuadChunk + 1);
+      dispatch_apply(num_workers, loop_dispactch_queue_, ^(size_t) {
+        size_t first;
+        while ((first = cursor_ptr->fetch_add(ParallelQuadChunk)) < num_quads) {
+          size_t last = std::min(first + ParallelQuadChunk, num_quads);
+          WriteBulkQuads(dst, *quads_ptr, first, last, quad_texture_indices);
+        }
+      });
     }
     
-    quad_data_->index_count += Shape2DCommonData::IndicesForSingleElement;
+    // ---------------------------------------------------------------------------------------------------------
+    // 3. Merge (serial): Copy each segment in its batch in order, so draw calls are same as single threaded path
+    // ---------------------------------------------------------------------------------------------------------
+    for (size_t seg_idx = 0; seg_idx < segments.size(); seg_idx++) {
+      const auto& seg = segments[seg_idx];
+      if (seg_idx > 0) {
+        BATCH_INFO("Starts the new batch as number of indices ({0}) or texture slots ({1}) increases in the previous batch",
+                   quad_data_->index_count, quad_data_->texture_slot_index);
+        FlushQuadBatch();
+        quad_data_->StartBatch();
+      }
+      
+      // Load the new textures of segment. Slots are allocated in same order as planned
+      for (uint32_t slot = seg.first_slot; slot < seg.num_slots; slot++) {
+        const Texture* texture = seg.textures[slot];
+        quad_data_->AddTextureSlot(texture, texture->GetRendererID());
+      }
+      
+      uint32_t seg_quads = (uint32_t)(seg.end_quad - seg.first_quad);
+      memcpy(quad_data_->DataPtr(), bulk_vertices.data() + seg.first_quad * quad_size, seg_quads * quad_size);
+      quad_data_->AdvanceQuads(seg_quads);
+    }
     
-    RendererStatistics::Get().index_count += Shape2DCommonData::IndicesForSingleElement;
-    RendererStatistics::Get().vertex_count += Shape2DCommonData::VertexForSingleElement;
+    RendererStatistics::Get().index_count += (uint32_t)num_quads * Shape2DCommonData::IndicesForSingleElement;
+    RendererStatistics::Get().vertex_count += (uint32_t)num_quads * Shape2DCommonData::VertexForSingleElement;
     
-    RendererStatistics::Get().stats_2d_.quads ++;
+    RendererStatistics::Get().stats_2d_.quads += (uint32_t)num_quads;
+    if (quad_data_->instanced)
+      RendererStatistics::Get().stats_2d_.quad_instances += (uint32_t)num_quads;
   }
   
   void Batch2DRenderer::DrawCircle(const glm::vec3& position, const glm::vec3& radius, const glm::vec3& rotation, const glm::vec4& color,
@@ -570,57 +1422,75 @@ namespace ikan {
   void Batch2DRenderer::DrawCircle(const glm::mat4& transform, const glm::vec4& color, float thickness, float fade, int32_t object_id) {
     DrawTextureCircle(transform, nullptr, 1.0f /* tiling factor */, color, thickness, fade, object_id);
   }
-  void Batch2DRenderer::DrawCircle(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, const glm::vec4& tint_color,
+  void Batch2DRenderer::DrawCircle(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color,
                                    float tiling_factor, float thickness, float fade, int32_t object_id){
-    DrawTextureCircle(transform, texture, tiling_factor, tint_color, thickness, fade, object_id);
+    DrawTextureCircle(transform, texture.Get(), tiling_factor, tint_color, thickness, fade, object_id);
   }
   
-  void Batch2DRenderer::DrawTextureCircle(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, float tiling_factor,
+  void Batch2DRenderer::DrawTextureCircle(const glm::mat4& transform, const Texture* texture, float tiling_factor,
                                           const glm::vec4& tint_color, float thickness, float fade, int32_t object_id) {
+    // Circle is stored in the ordered stream of quad batch with Unified vertex format
+    if (!circle_data_) {
+      DrawShape(ShapeKind::Circle, transform, texture, tiling_factor, tint_color, thickness, fade, object_id);
+      return;
+    }
+    
     // If number of indices increase in batch then start new batch
     if (circle_data_->index_count >= circle_data_->max_indices) {
       BATCH_INFO("Starts the new batch as number of indices ({0}) increases in the previous batch", circle_data_->index_count);
-      EndBatch();
+      FlushCircleBatch();
       circle_data_->StartBatch();
     }
     
     float texture_index = 0.0f;
     if (texture) {
       // Find if texture is already loaded in current batch
-      for (size_t i = 1; i < circle_data_->texture_slot_index; i++) {
-        if (circle_data_->texture_slots[i].get() == texture.get()) {
-          // Found the current textue in the batch
-          texture_index = (float)i;
-          break;
-        }
-      }
+      RendererID renderer_id = texture->GetRendererID();
+      uint32_t slot = circle_data_->FindTextureSlot(renderer_id);
       
       // If current texture slot is not pre loaded then load the texture in proper slot
-      if (texture_index == 0.0f) {
+      if (slot == 0) {
         // If number of slots increases max then start new batch
         if (circle_data_->texture_slot_index >= MaxTextureSlotsInShader) {
           BATCH_INFO("Starts the new batch as number of texture slot ({0}) increases in the previous batch", circle_data_->texture_slot_index);
-          NextBatch();
+          FlushCircleBatch();
+          circle_data_->StartBatch();
         }
         
         // Loading the current texture in the first free slot slot
-        texture_index = (float)circle_data_->texture_slot_index;
-        circle_data_->texture_slots[circle_data_->texture_slot_index] = texture;
-        circle_data_->texture_slot_index++;
+        slot = circle_data_->AddTextureSlot(texture, renderer_id);
       }
+      texture_index = (float)slot;
     }
     
-    for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
-      circle_data_->vertex_buffer_ptr->position         = transform * circle_data_->vertex_base_position[i];
-      circle_data_->vertex_buffer_ptr->color            = tint_color;
-      circle_data_->vertex_buffer_ptr->texture_coords   = 2.0f * circle_data_->vertex_base_position[i];
-      circle_data_->vertex_buffer_ptr->texture_index    = texture_index;
-      circle_data_->vertex_buffer_ptr->tiling_factor    = tiling_factor;
-      circle_data_->vertex_buffer_ptr->local_position   = 2.0f * circle_data_->vertex_base_position[i];
-      circle_data_->vertex_buffer_ptr->thickness        = thickness;
-      circle_data_->vertex_buffer_ptr->fade             = fade;
-      circle_data_->vertex_buffer_ptr->pixel_id         = object_id;
-      circle_data_->vertex_buffer_ptr++;
+    if (circle_data_->packed_vertex_buffer_base_ptr) {
+      uint32_t packed_color = glm::packUnorm4x8(tint_color);
+      uint32_t packed_thickness_fade = glm::packHalf2x16({thickness, fade});
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        glm::vec2 local_position = 2.0f * glm::vec2(circle_data_->vertex_base_position[i]);
+        circle_data_->packed_vertex_buffer_ptr->position        = transform * circle_data_->vertex_base_position[i];
+        circle_data_->packed_vertex_buffer_ptr->color           = packed_color;
+        circle_data_->packed_vertex_buffer_ptr->texture_coords  = glm::packHalf2x16(local_position * tiling_factor);
+        circle_data_->packed_vertex_buffer_ptr->texture_index   = (uint32_t)texture_index;
+        circle_data_->packed_vertex_buffer_ptr->local_position  = glm::packHalf2x16(local_position);
+        circle_data_->packed_vertex_buffer_ptr->thickness_fade  = packed_thickness_fade;
+        circle_data_->packed_vertex_buffer_ptr->pixel_id        = object_id;
+        circle_data_->packed_vertex_buffer_ptr++;
+      }
+    }
+    else {
+      for (size_t i = 0; i < Shape2DCommonData::VertexForSingleElement; i++) {
+        circle_data_->vertex_buffer_ptr->position         = transform * circle_data_->vertex_base_position[i];
+        circle_data_->vertex_buffer_ptr->color            = tint_color;
+        circle_data_->vertex_buffer_ptr->texture_coords   = 2.0f * circle_data_->vertex_base_position[i];
+        circle_data_->vertex_buffer_ptr->texture_index    = texture_index;
+        circle_data_->vertex_buffer_ptr->tiling_factor    = tiling_factor;
+        circle_data_->vertex_buffer_ptr->local_position   = 2.0f * circle_data_->vertex_base_position[i];
+        circle_data_->vertex_buffer_ptr->thickness        = thickness;
+        circle_data_->vertex_buffer_ptr->fade             = fade;
+        circle_data_->vertex_buffer_ptr->pixel_id         = object_id;
+        circle_data_->vertex_buffer_ptr++;
+      }
     }
     
     circle_data_->index_count += Shape2DCommonData::IndicesForSingleElement;
@@ -630,12 +1500,50 @@ namespace ikan {
     RendererStatistics::Get().stats_2d_.circles++;
   }
   
+  void Batch2DRenderer::DrawRoundedQuad(const glm::mat4& transform, const glm::vec4& color, float corner_radius, float fade,
+                                        int32_t object_id) {
+    if (quad_data_->shape_vertex_buffer_base_ptr)
+      DrawShape(ShapeKind::RoundedRect, transform, nullptr, 1.0f /* tiling factor */, color, corner_radius, fade, object_id);
+    else
+      DrawTextureQuad(transform, nullptr, texture_coords_, 1.0f /* tiling factor */, color, object_id);
+  }
+  
+  void Batch2DRenderer::DrawShape(ShapeKind kind, const glm::mat4& transform, const Texture* texture, float tiling_factor,
+                                  const glm::vec4& tint_color, float param, float fade, int32_t object_id) {
+    IK_CORE_ASSERT(quad_data_->shape_vertex_buffer_base_ptr, "Shapes can be rendered only with Unified vertex format");
+    
+    // If number of indices increase in batch then start new batch
+    if (quad_data_->index_count >= quad_data_->max_indices) {
+      BATCH_INFO("Starts the new batch as number of indices ({0}) increases in the previous batch", quad_data_->index_count);
+      FlushQuadBatch();
+      quad_data_->StartBatch();
+    }
+    
+    float texture_index = (float)GetQuadTextureSlot(texture);
+    
+    // Circle texture coordinates are same as its local position (existing circle convention)
+    static constexpr glm::vec2 circle_texture_coords[] = {
+      { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f }
+    };
+    const glm::vec2* texture_coords = kind == ShapeKind::Circle ? circle_texture_coords : texture_coords_;
+    quad_data_->AddShape(transform, texture_coords, tiling_factor, tint_color, texture_index, kind, param, fade, object_id);
+    quad_data_->index_count += Shape2DCommonData::IndicesForSingleElement;
+    
+    RendererStatistics::Get().index_count += Shape2DCommonData::IndicesForSingleElement;
+    RendererStatistics::Get().vertex_count += Shape2DCommonData::VertexForSingleElement;
+    
+    if (kind == ShapeKind::Circle)
+      RendererStatistics::Get().stats_2d_.circles++;
+    else
+      RendererStatistics::Get().stats_2d_.quads++;
+  }
+  
   void Batch2DRenderer::DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color) {
     
     // If number of indices increase in batch then start new batch
     if (line_data_->vertex_count >= line_data_->max_vertices) {
       BATCH_INFO("Starts the new batch as number of vertices ({0}) increases in the previous batch", line_data_->vertex_count);
-      EndBatch();
+      FlushLineBatch();
       line_data_->StartBatch();
     }
     
@@ -0,0 +1,343 @@
+//
+//  render_queue_2d.cpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "render_queue_2d.hpp"
+#include "renderer/utils/batch_2d_renderer.hpp"
+#include "renderer/utils/renderer_stats.hpp"
+#include "renderer/graphics/shader.hpp"
+#include "renderer/graphics/texture.hpp"
+#include "renderer/graphics/texture_atlas.hpp"
+
+namespace ikan {
+
+  /// This structure holds the data of queue for all the sprites submitted in a frame
+  struct RenderQueue2DData {
+    /// Shader (Shape) of sprite. Stored in key so that same shapes are contiguous
+    enum Shader : uint8_t {
+      Quad = 0, Circle = 1
+    };
+
+    /// Stores all the data needed to emit a sprite to Batch renderer
+    struct Payload {
+      Shader shader = Quad;
+      glm::mat4 transform;
+      glm::vec4 color;
+      TextureHandle texture;
+      /// Renderer ID of texture (0 for no texture), resolved once at submission
+      uint32_t texture_id = 0;
+      /// Texture coordinates of quad (min u, min v, max u, max v). Tiling factor of quad is folded in it
+      glm::vec4 uv_rect = { 0.0f, 0.0f, 1.0f, 1.0f };
+      float tiling_factor = 1.0f;
+      float thickness = 1.0f;
+      float fade = 0.005f;
+      int32_t object_id = -1;
+    };
+
+    /// Sort key along with index of its payload
+    struct KeyIndex {
+      uint64_t key;
+      uint32_t index;
+    };
+
+    // Constants
+    static constexpr uint32_t RadixBits = 8;
+    static constexpr uint32_t RadixBuckets = 1 << RadixBits;
+    static constexpr uint32_t RadixPasses = sizeof(uint64_t) * 8 / RadixBits;
+
+    // Bits of each field in key
+    static constexpr uint32_t TextureBits = 20;
+    static constexpr uint32_t ShaderBits = 4;
+    static constexpr uint32_t DepthBits = 32;
+
+    std::vector<Payload> payloads;
+    std::vector<KeyIndex> keys;
+    /// Atlas to remap the textures of quads in current frame (optional)
+    const TextureAtlas* texture_atlas = nullptr;
+    /// Scratch buffer for radix sort. Reused each frame to avoid reallocation
+    std::vector<KeyIndex> scratch_keys;
+
+    /// Structure of arrays of consecutive sorted quads, emitted to Batch renderer in bulk. Axis aligned quads are stored with position
+    /// and half extent, so that Batch renderer generates their corners with SIMD across quads. Other quads are stored with transform
+    struct QuadRun {
+      bool axis_aligned = false;
+      std::vector<glm::mat4> transforms;
+      std::vector<glm::vec3> positions;
+      std::vector<glm::vec2> half_extents;
+      std::vector<glm::vec4> colors;
+      std::vector<glm::vec4> uv_rects;
+      std::vector<TextureHandle> textures;
+      std::vector<int32_t> object_ids;
+
+      void Clear() {
+        transforms.clear();
+        positions.clear();
+        half_extents.clear();
+        colors.clear();
+        uv_rects.clear();
+        textures.clear();
+        object_ids.clear();
+      }
+    } quad_run;
+  };
+  static RenderQueue2DData queue_data_;
+
+  uint64_t RenderQueue2D::MakeKey(uint8_t layer, float depth, uint8_t shader, uint32_t texture) {
+    // Flip the float bits so that unsigned compare gives same order as float compare
+    uint32_t depth_bits;
+    memcpy(&depth_bits, &depth, sizeof(float));
+    depth_bits = (depth_bits & 0x80000000) ? ~depth_bits : (depth_bits | 0x80000000);
+
+    uint64_t key = (uint64_t)layer;
+    key = (key << RenderQueue2DData::DepthBits) | depth_bits;
+    key = (key << RenderQueue2DData::ShaderBits) | (shader & ((1u << RenderQueue2DData::ShaderBits) - 1));
+    key = (key << RenderQueue2DData::TextureBits) | (texture & ((1u << RenderQueue2DData::TextureBits) - 1));
+    return key;
+  }
+
+  void RenderQueue2D::Begin(const TextureAtlas* texture_atlas) {
+    queue_data_.payloads.clear();
+    queue_data_.keys.clear();
+    queue_data_.texture_atlas = texture_atlas;
+  }
+
+  void RenderQueue2D::SubmitQuad(const glm::mat4& transform, const glm::vec4& color, int32_t object_id, uint8_t layer) {
+    queue_data_.keys.push_back({MakeKey(layer, transform[3][2], RenderQueue2DData::Quad, 0), (uint32_t)queue_data_.payloads.size()});
+
+    auto& payload = queue_data_.payloads.emplace_back();
+    payload.shader = RenderQueue2DData::Quad;
+    payload.transform = transform;
+    payload.color = color;
+    payload.object_id = object_id;
+  }
+
+  void RenderQueue2D::SubmitQuad(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color,
+                                 float tiling_factor, int32_t object_id, uint8_t layer) {
+    // Tiled texture can not be remapped to atlas, as atlas page do not repeat the texture
+    glm::vec4 uv_rect = { 0.0f, 0.0f, tiling_factor, tiling_factor };
+    TextureHandle quad_texture = texture;
+    if (queue_data_.texture_atlas and tiling_factor == 1.0f)
+      queue_data_.texture_atlas->Remap(texture, uv_rect, quad_texture);
+    SubmitQuadImpl(transform, quad_texture, uv_rect, tint_color, object_id, layer);
+  }
+
+  void RenderQueue2D::SubmitQuad(const glm::mat4& transform, const std::shared_ptr<SubTexture>& sub_texture, const glm::vec4& tint_color,
+                                 int32_t object_id, uint8_t layer) {
+    TextureHandle texture = sub_texture ? sub_texture->GetSpriteHandle() : TextureHandle();
+    glm::vec4 uv_rect = { 0.0f, 0.0f, 1.0f, 1.0f };
+    if (sub_texture) {
+      const glm::vec2* texture_coords = sub_texture->GetTexCoord();
+      uv_rect = { texture_coords[0], texture_coords[2] };
+      if (queue_data_.texture_atlas)
+        queue_data_.texture_atlas->Remap(texture, uv_rect, texture);
+    }
+    SubmitQuadImpl(transform, texture, uv_rect, tint_color, object_id, layer);
+  }
+
+  void RenderQueue2D::SubmitQuad(const glm::mat4& transform, const SpriteSheet& sprite_sheet, SpriteSheet::FrameID frame,
+                                 const glm::vec4& tint_color, int32_t object_id, uint8_t layer) {
+    TextureHandle texture = sprite_sheet.GetTextureHandle();
+    glm::vec4 uv_rect = sprite_sheet.GetFrameUV(frame);
+    if (queue_data_.texture_atlas)
+      queue_data_.texture_atlas->Remap(texture, uv_rect, texture);
+    SubmitQuadImpl(transform, texture, uv_rect, tint_color, object_id, layer);
+  }
+
+  void RenderQueue2D::SubmitQuadImpl(const glm::mat4& transform, TextureHandle texture, const glm::vec4& uv_rect,
+                                     const glm::vec4& tint_color, int32_t object_id, uint8_t layer) {
+    const Texture* resolved_texture = texture.Get();
+    uint32_t texture_id = resolved_texture ? resolved_texture->GetRendererID() : 0;
+    queue_data_.keys.push_back({MakeKey(layer, transform[3][2], RenderQueue2DData::Quad, texture_id), (uint32_t)queue_data_.payloads.size()});
+
+    auto& payload = queue_data_.payloads.emplace_back();
+    payload.shader = RenderQueue2DData::Quad;
+    payload.transform = transform;
+    payload.color = tint_color;
+    payload.texture = texture;
+    payload.texture_id = texture_id;
+    payload.uv_rect = uv_rect;
+    payload.object_id = object_id;
+  }
+
+  void RenderQueue2D::SubmitCircle(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color,
+                                   float tiling_factor, float thickness, float fade, int32_t object_id, uint8_t layer) {
+    const Texture* resolved_texture = texture.Get();
+    uint32_t texture_id = resolved_texture ? resolved_texture->GetRendererID() : 0;
+    queue_data_.keys.push_back({MakeKey(layer, transform[3][2], RenderQueue2DData::Circle, texture_id), (uint32_t)queue_data_.payloads.size()});
+
+    auto& payload = queue_data_.payloads.emplace_back();
+    payload.shader = RenderQueue2DData::Circle;
+    payload.transform = transform;
+    payload.color = tint_color;
+    payload.texture = texture;
+    payload.texture_id = texture_id;
+    payload.tiling_factor = tiling_factor;
+    payload.thickness = thickness;
+    payload.fade = fade;
+    payload.object_id = object_id;
+  }
+
+  uint32_t RenderQueue2D::Size() {
+    return (uint32_t)queue_data_.keys.size();
+  }
+
+  void RenderQueue2D::RadixSort() {
+    auto& src = queue_data_.keys;
+    auto& dst = queue_data_.scratch_keys;
+    dst.resize(src.size());
+
+    const size_t num_keys = src.size();
+    for (uint32_t pass = 0; pass < RenderQueue2DData::RadixPasses; pass++) {
+      const uint32_t shift = pass * RenderQueue2DData::RadixBits;
+
+      // Histogram of current digit
+      uint32_t count[RenderQueue2DData::RadixBuckets] = {0};
+      for (const auto& ki : src)
+        count[(ki.key >> shift) & (RenderQueue2DData::RadixBuckets - 1)]++;
+
+      // Skip the pass if all the keys have same digit (e.g. layer or shader bits are mostly same)
+      if (count[(src[0].key >> shift) & (RenderQueue2DData::RadixBuckets - 1)] == num_keys)
+        continue;
+
+      // Prefix sum to get the offset of each bucket
+      uint32_t offset = 0;
+      for (uint32_t b = 0; b < RenderQueue2DData::RadixBuckets; b++) {
+        uint32_t c = count[b];
+        count[b] = offset;
+        offset += c;
+      }
+
+      // Scatter (stable)
+      for (const auto& ki : src)
+        dst[count[(ki.key >> shift) & (RenderQueue2DData::RadixBuckets - 1)]++] = ki;
+
+      std::swap(src, dst);
+    }
+  }
+
+  uint32_t RenderQueue2D::EstimateBatches(bool sorted) {
+    const auto& stats_2d = RendererStatistics::Get().stats_2d_;
+
+    // Simulate the batch break rule of Batch2DRenderer for each shape separately, as each shape has its own batch (except Unified
+    // vertex format, where circles are stored in quad batch)
+    const bool unified = Batch2DRenderer::GetVertexFormat() == Batch2DRenderer::VertexFormat::Unified;
+    struct BatchState {
+      uint32_t max_elements = 0;
+      uint32_t elements = 0;
+      uint32_t batches = 0;
+      uint32_t num_slots = 1; // 0 = white texture
+      std::array<uint32_t, MaxTextureSlotsInShader> slots;
+    } states[2];
+    states[RenderQueue2DData::Quad].max_elements = stats_2d.max_quads;
+    states[RenderQueue2DData::Circle].max_elements = stats_2d.max_circles;
+
+    const size_t num_sprites = queue_data_.payloads.size();
+    for (size_t i = 0; i < num_sprites; i++) {
+      const auto& payload = queue_data_.payloads[sorted ? queue_data_.keys[i].index : i];
+      auto& state = states[unified ? RenderQueue2DData::Quad : payload.shader];
+
+      if (state.elements == 0 or state.elements >= state.max_elements) {
+        state.batches++;
+        state.elements = 0;
+        state.num_slots = 1;
+      }
+
+      if (payload.texture_id) {
+        uint32_t texture_id = payload.texture_id;
+        bool found = false;
+        for (uint32_t s = 1; s < state.num_slots; s++) {
+          if (state.slots[s] == texture_id) {
+            found = true;
+            break;
+          }
+        }
+
+        if (!found) {
+          if (state.num_slots >= MaxTextureSlotsInShader) {
+            state.batches++;
+            state.elements = 0;
+            state.num_slots = 1;
+          }
+          state.slots[state.num_slots++] = texture_id;
+        }
+      }
+      state.elements++;
+    }
+    return states[RenderQueue2DData::Quad].batches + states[RenderQueue2DData::Circle].batches;
+  }
+
+  void RenderQueue2D::End() {
+    RETURN_IF(queue_data_.keys.empty());
+
+    // Batches are estimated only for the stats widget
+    auto& stats_2d = RendererStatistics::Get().stats_2d_;
+    if (stats_2d.estimate_batches)
+      stats_2d.batches_unsorted += EstimateBatches(false);
+    RadixSort();
+    if (stats_2d.estimate_batches)
+      stats_2d.batches_sorted += EstimateBatches(true);
+
+    // Emit the sprites to Batch renderer in sorted order. Consecutive quads are collected and emitted in bulk, so that their vertices
+    // can be generated in parallel. Quad run is emitted before next circle, so the order is kept even if both shapes share one batch
+    // (Unified vertex format)
+    auto& run = queue_data_.quad_run;
+    auto flush_quad_run = [&run]() {
+      RETURN_IF(run.object_ids.empty());
+      Batch2DRenderer::Quads2D quads;
+      if (run.axis_aligned) {
+        quads.positions = run.positions;
+        quads.half_extents = run.half_extents;
+      }
+      else {
+        quads.transforms = run.transforms;
+      }
+      quads.colors = run.colors;
+      quads.uv_rects = run.uv_rects;
+      quads.textures = run.textures;
+      quads.object_ids = run.object_ids;
+      Batch2DRenderer::DrawQuads(quads);
+      run.Clear();
+    };
+
+    for (const auto& ki : queue_data_.keys) {
+      const auto& payload = queue_data_.payloads[ki.index];
+      if (payload.shader == RenderQueue2DData::Circle) {
+        flush_quad_run();
+        if (payload.texture_id)
+          Batch2DRenderer::DrawCircle(payload.transform, payload.texture, payload.color, payload.tiling_factor, payload.thickness, payload.fade,
+                                      payload.object_id);
+        else
+          Batch2DRenderer::DrawCircle(payload.transform, payload.color, payload.thickness, payload.fade, payload.object_id);
+      }
+      else {
+        // Quad is axis aligned if its x and y axes are not rotated. Its corners are then center -/+ half of the axes lengths
+        const glm::mat4& transform = payload.transform;
+        const bool axis_aligned = transform[0][1] == 0.0f and transform[0][2] == 0.0f and transform[1][0] == 0.0f and
+                                  transform[1][2] == 0.0f;
+        if (axis_aligned != run.axis_aligned) {
+          flush_quad_run();
+          run.axis_aligned = axis_aligned;
+        }
+        
+        if (axis_aligned) {
+          run.positions.emplace_back(transform[3]);
+          run.half_extents.emplace_back(0.5f * transform[0][0], 0.5f * transform[1][1]);
+        }
+        else {
+          run.transforms.push_back(transform);
+        }
+        run.colors.push_back(payload.color);
+        run.uv_rects.push_back(payload.uv_rect);
+        run.textures.push_back(payload.texture);
+        run.object_ids.push_back(payload.object_id);
+      }
+    }
+    flush_quad_run();
+
+    Begin();
+  }
+
+} // namespace ikan
@@ -32,6 +32,7 @@ namespace ikan {
   struct RendererData {
     Renderer::Api api = Renderer::Api::None;
     std::unique_ptr<RendererAPI> renderer_api_instance;
+    glm::uvec2 viewport_size = { 0, 0 };
 
     RendererData(Renderer::Api new_api) : api(new_api) {
       IK_CORE_TRACE(LogModule::Renderer, "Setting the Renderer API as {0} ...", renderer_utils::GetRendererApiName(api));
@@ -49,7 +50,7 @@ namespace ikan {
   void Renderer::Initialize() {
     renderer_data_->renderer_api_instance = RendererAPI::Create();
     
-    Batch2DRenderer::Initialise(100, 100, 100);
+    Batch2DRenderer::Initialise();
     TextRenderer::Initialise();
   }
   void Renderer::Shutdown() {
@@ -106,6 +107,10 @@ namespace ikan {
   
   void Renderer::SetViewport(uint32_t width, uint32_t height) {
     renderer_data_->renderer_api_instance->SetViewport(width, height);
+    renderer_data_->viewport_size = { width, height };
+  }
+  const glm::uvec2& Renderer::GetViewportSize() {
+    return renderer_data_->viewport_size;
   }
   void Renderer::GetEntityIdFromPixels(int32_t mx, int32_t my, uint32_t pixel_id_index, int32_t& pixel_data) {
     renderer_data_->renderer_api_instance->GetEntityIdFromPixels(mx, my, pixel_id_index, pixel_data);
@@ -124,6 +129,14 @@ namespace ikan {
   // -------------------------------------------------------------------------
   std::shared_ptr<Shader> Renderer::GetShader(const std::string& path) { return ShaderLibrary::GetShader(path); }
   std::shared_ptr<Texture> Renderer::GetTexture(const std::string& path, bool linear) { return TextureLibrary::GetTexture(path, linear); }
+  std::shared_ptr<Texture> Renderer::GetTextureAsync(const std::string& path, bool linear) {
+    return TextureLibrary::GetTextureAsync(path, linear);
+  }
+  void Renderer::PreloadTextures(const std::vector<std::pair<std::string, bool>>& textures) { TextureLibrary::PreloadTextures(textures); }
+  void Renderer::UpdateTextureLibrary() { TextureLibrary::Update(); }
+  void Renderer::UpdateBatchCapacity() { Batch2DRenderer::AdaptCapacity(); }
+  void Renderer::SetTextureBudget(size_t bytes) { TextureLibrary::SetBudget(bytes); }
+  void Renderer::RenderTextureLibraryGui(bool *is_open) { TextureLibrary::RenderGui(is_open); }
 
   void Renderer::DrawIndexed(const std::shared_ptr<Pipeline>& pipeline, uint32_t count) {
     renderer_data_->renderer_api_instance->DrawIndexed(pipeline, count);
@@ -134,6 +147,9 @@ namespace ikan {
   void Renderer::DrawArrays(const std::shared_ptr<Pipeline>& pipeline, uint32_t count) {
     renderer_data_->renderer_api_instance->DrawArrays(pipeline, count);
   }
+  void Renderer::DrawIndexedInstanced(const std::shared_ptr<Pipeline>& pipeline, uint32_t count, uint32_t instance_count) {
+    renderer_data_->renderer_api_instance->DrawIndexedInstanced(pipeline, count, instance_count);
+  }
 
   // -------------------------------------------------------------------------
   // Renderer Capabilities
@@ -14,11 +14,11 @@ namespace ikan {
   void RendererStatistics::Renderer2DStats::RenderGui(bool* is_open) {
     CHECK_WIDGET_FLAG(is_open);
     
-    ImGui::Begin("Renderer 2D Stats", is_open);
-    ImGui::SetNextWindowContentSize(ImVec2(360, 0.0f));
+    widget_visible = ImGui::Begin("Renderer 2D Stats", is_open);
+    ImGui::SetNextWindowContentSize(ImVec2(840, 0.0f));
     ImGui::BeginChild("##RendererStats2D", ImVec2(0, ImGui::GetFontSize() * 2), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    ImGui::Columns(6);
+    ImGui::Columns(14);
     
     ImGui::SetColumnWidth(0, 60);
     ImGui::Text("%d", max_quads);
@@ -50,6 +50,46 @@ namespace ikan {
     PropertyGrid::HoveredMsg("Num Lines Rendered");
     ImGui::NextColumn();
 
+    ImGui::SetColumnWidth(6, 60);
+    ImGui::Text("%d", batches_unsorted);
+    PropertyGrid::HoveredMsg("Num Batches before sorting the Render Queue");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(7, 60);
+    ImGui::Text("%d", batches_sorted);
+    PropertyGrid::HoveredMsg("Num Batches after sorting the Render Queue");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(8, 60);
+    ImGui::Text("%d", quad_instances);
+    PropertyGrid::HoveredMsg("Num Quad Instances Rendered (Instanced Mode)");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(9, 60);
+    ImGui::Text("%d", instanced_draw_calls);
+    PropertyGrid::HoveredMsg("Num Instanced Draw Calls");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(10, 60);
+    ImGui::Text("%d", static_quads);
+    PropertyGrid::HoveredMsg("Num Static Quads Rendered from cached chunks");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(11, 60);
+    ImGui::Text("%d", static_chunk_uploads);
+    PropertyGrid::HoveredMsg("Num Static Chunks uploaded again (changed)");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(12, 60);
+    ImGui::Text("%d", sprites_submitted);
+    PropertyGrid::HoveredMsg("Num Sprites submitted (inside camera view)");
+    ImGui::NextColumn();
+
+    ImGui::SetColumnWidth(13, 60);
+    ImGui::Text("%d", sprites_culled);
+    PropertyGrid::HoveredMsg("Num Sprites culled (outside camera view)");
+    ImGui::NextColumn();
+
     ImGui::Columns(1);
     ImGui::EndChild();
     ImGui::End();
@@ -121,6 +161,16 @@ namespace ikan {
     stats_2d_.quads = 0;
     stats_2d_.circles = 0;
     stats_2d_.lines = 0;
+    stats_2d_.batches_unsorted = 0;
+    stats_2d_.batches_sorted = 0;
+    stats_2d_.quad_instances = 0;
+    stats_2d_.instanced_draw_calls = 0;
+    stats_2d_.static_quads = 0;
+    stats_2d_.static_chunk_uploads = 0;
+    stats_2d_.sprites_submitted = 0;
+    stats_2d_.sprites_culled = 0;
+    stats_2d_.estimate_batches = stats_2d_.widget_visible;
+    stats_2d_.widget_visible = false;
   }
   
   void RendererStatistics::ResetAll() {
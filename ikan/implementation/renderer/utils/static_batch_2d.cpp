@@ -0,0 +1,261 @@
+//
+//  static_batch_2d.cpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "static_batch_2d.hpp"
+#include "renderer/utils/renderer_stats.hpp"
+#include "renderer/graphics/pipeline.hpp"
+#include "renderer/graphics/renderer_buffer.hpp"
+#include "renderer/graphics/texture.hpp"
+
+namespace ikan {
+
+  StaticBatch2D::StaticBatch2D(uint32_t max_quads_per_chunk)
+  : max_quads_per_chunk_(max_quads_per_chunk) {
+    IK_CORE_TRACE(LogModule::Batch2DRenderer, "Creating Static Batch 2D ...");
+    IK_CORE_TRACE(LogModule::Batch2DRenderer, "  Max Quads per Chunk {0}", max_quads_per_chunk_);
+
+    // Index Buffer is same for all the chunks
+    uint32_t max_indices = max_quads_per_chunk_ * IndicesForSingleQuad;
+    uint32_t* indices = new uint32_t[max_indices];
+    uint32_t offset = 0;
+    for (size_t i = 0; i < max_indices; i += IndicesForSingleQuad) {
+      indices[i + 0] = offset + 0;
+      indices[i + 1] = offset + 1;
+      indices[i + 2] = offset + 2;
+
+      indices[i + 3] = offset + 2;
+      indices[i + 4] = offset + 3;
+      indices[i + 5] = offset + 0;
+
+      offset += 4;
+    }
+    index_buffer_ = IndexBuffer::CreateWithCount(indices, max_indices);
+    delete[] indices;
+
+    // Creating white texture for colorful quads witout any texture or sprite
+    uint32_t white_texture_data = 0xffffffff;
+    white_texture_ = Texture::Create(1, 1, &white_texture_data, sizeof(uint32_t));
+
+    shader_ = Renderer::GetShader(DM::CoreAsset("shaders/batch_quad_shader.glsl"));
+
+    // Setting basic Vertex point of quad
+    vertex_base_position_[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
+    vertex_base_position_[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
+    vertex_base_position_[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
+    vertex_base_position_[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
+  }
+
+  StaticBatch2D::~StaticBatch2D() {
+    IK_CORE_TRACE(LogModule::Batch2DRenderer, "Destroying Static Batch 2D !!!");
+    IK_CORE_TRACE(LogModule::Batch2DRenderer, "  Num Chunks {0}", chunks_.size());
+    IK_CORE_TRACE(LogModule::Batch2DRenderer, "  Num Quads  {0}", entries_.size());
+    Clear();
+  }
+
+  void StaticBatch2D::Clear() {
+    chunks_.clear();
+    entries_.clear();
+  }
+
+  int32_t StaticBatch2D::GetTextureSlot(Chunk& chunk, TextureHandle texture) {
+    if (!texture)
+      return 0;
+
+    int32_t free_slot = -1;
+    for (uint32_t i = 1; i < chunk.num_textures; i++) {
+      if (chunk.textures[i] == texture)
+        return (int32_t)i;
+      if (free_slot < 0 and chunk.texture_refs[i] == 0)
+        free_slot = (int32_t)i;
+    }
+
+    if (free_slot < 0) {
+      if (chunk.num_textures >= MaxTextureSlotsInShader)
+        return -1;
+      free_slot = (int32_t)chunk.num_textures++;
+    }
+    chunk.textures[free_slot] = texture;
+    return free_slot;
+  }
+
+  void StaticBatch2D::ReleaseTextureSlot(Chunk& chunk, uint32_t texture_slot) {
+    RETURN_IF(texture_slot == 0);
+    if (--chunk.texture_refs[texture_slot] == 0)
+      chunk.textures[texture_slot] = TextureHandle();
+  }
+
+  uint32_t StaticBatch2D::GetFreeChunk(TextureHandle texture) {
+    for (uint32_t i = 0; i < chunks_.size(); i++) {
+      auto& chunk = *chunks_[i];
+      if (chunk.keys.size() >= max_quads_per_chunk_)
+        continue;
+      if (GetTextureSlot(chunk, texture) >= 0)
+        return i;
+    }
+
+    // Create new chunk
+    auto& chunk = chunks_.emplace_back(std::make_unique<Chunk>());
+    chunk->textures[0] = TextureHandle(white_texture_);
+    chunk->vertices.reserve(max_quads_per_chunk_ * VertexForSingleQuad);
+    chunk->keys.reserve(max_quads_per_chunk_);
+
+    chunk->pipeline = Pipeline::Create();
+    chunk->vertex_buffer = VertexBuffer::Create(max_quads_per_chunk_ * VertexForSingleQuad * sizeof(Vertex));
+    chunk->vertex_buffer->AddLayout({
+      { "a_Position",     ShaderDataType::Float3 },
+      { "a_Color",        ShaderDataType::Float4 },
+      { "a_TexCoords",    ShaderDataType::Float2 },
+      { "a_TexIndex",     ShaderDataType::Float },
+      { "a_TilingFactor", ShaderDataType::Float },
+      { "a_ObjectID",     ShaderDataType::Int },
+    });
+    chunk->pipeline->AddVertexBuffer(chunk->vertex_buffer);
+    chunk->pipeline->SetIndexBuffer(index_buffer_);
+
+    GetTextureSlot(*chunk, texture);
+    return (uint32_t)chunks_.size() - 1;
+  }
+
+  void StaticBatch2D::RemoveFromChunk(const Entry& entry) {
+    auto& chunk = *chunks_[entry.chunk];
+    ReleaseTextureSlot(chunk, entry.texture_slot);
+
+    // Move the last quad of chunk in the slot of removed quad
+    uint32_t last_slot = (uint32_t)chunk.keys.size() - 1;
+    if (entry.slot != last_slot) {
+      std::copy_n(chunk.vertices.begin() + last_slot * VertexForSingleQuad, VertexForSingleQuad,
+                  chunk.vertices.begin() + entry.slot * VertexForSingleQuad);
+      chunk.keys[entry.slot] = chunk.keys[last_slot];
+      entries_.at(chunk.keys[entry.slot]).slot = entry.slot;
+    }
+    chunk.keys.pop_back();
+    chunk.vertices.resize(chunk.keys.size() * VertexForSingleQuad);
+    chunk.dirty = true;
+
+    // All texture slots of empty chunk are free, so slots are compacted
+    if (chunk.keys.empty())
+      chunk.num_textures = 1;
+  }
+
+  void StaticBatch2D::RemoveQuad(uint64_t key) {
+    auto it = entries_.find(key);
+    RETURN_IF(it == entries_.end());
+    
+    RemoveFromChunk(it->second);
+    entries_.erase(it);
+  }
+
+  void StaticBatch2D::SubmitQuad(uint64_t key, const glm::mat4& transform, TextureHandle texture, const glm::vec2* texture_coords,
+                                 float tiling_factor, const glm::vec4& tint_color, int32_t object_id) {
+    auto it = entries_.find(key);
+
+    // Reuse the slot if texture can be loaded in same chunk, else move the quad to other chunk. Texture slot of old texture is released
+    // once quad is moved to new texture slot
+    int32_t texture_index = -1;
+    if (it != entries_.end()) {
+      auto& entry = it->second;
+      auto& chunk = *chunks_[entry.chunk];
+      texture_index = GetTextureSlot(chunk, texture);
+      if (texture_index < 0) {
+        RemoveFromChunk(entry);
+        entries_.erase(it);
+        it = entries_.end();
+      }
+      else if ((uint32_t)texture_index != entry.texture_slot) {
+        if (texture_index > 0)
+          chunk.texture_refs[texture_index]++;
+        ReleaseTextureSlot(chunk, entry.texture_slot);
+        entry.texture_slot = (uint32_t)texture_index;
+      }
+    }
+
+    if (it == entries_.end()) {
+      uint32_t chunk_idx = GetFreeChunk(texture);
+      auto& chunk = *chunks_[chunk_idx];
+
+      Entry entry;
+      entry.chunk = chunk_idx;
+      entry.slot = (uint32_t)chunk.keys.size();
+      chunk.keys.push_back(key);
+      chunk.vertices.resize(chunk.keys.size() * VertexForSingleQuad);
+
+      texture_index = GetTextureSlot(chunk, texture);
+      entry.texture_slot = (uint32_t)texture_index;
+      if (texture_index > 0)
+        chunk.texture_refs[texture_index]++;
+      it = entries_.emplace(key, entry).first;
+    }
+
+    auto& entry = it->second;
+    auto& chunk = *chunks_[entry.chunk];
+    Vertex* vertex = &chunk.vertices[entry.slot * VertexForSingleQuad];
+    for (size_t i = 0; i < VertexForSingleQuad; i++) {
+      vertex->position         = transform * vertex_base_position_[i];
+      vertex->color            = tint_color;
+      vertex->texture_coords   = texture_coords[i];
+      vertex->texture_index    = (float)texture_index;
+      vertex->tiling_factor    = tiling_factor;
+      vertex->pixel_id         = object_id;
+      vertex++;
+    }
+    chunk.dirty = true;
+  }
+
+  uint32_t StaticBatch2D::Render(const glm::mat4& cam_view_proj_mat, const glm::vec4* view_bounds) {
+    if (entries_.empty())
+      return 0;
+
+    shader_->Bind();
+    shader_->SetUniformMat4("u_ViewProjection", cam_view_proj_mat);
+
+    auto& stats = RendererStatistics::Get();
+    uint32_t rendered_quads = 0;
+    for (auto& chunk_ptr : chunks_) {
+      auto& chunk = *chunk_ptr;
+      if (chunk.keys.empty())
+        continue;
+
+      // Upload only the changed chunks. Bounds are computed with upload, so unchanged chunks are culled without visiting vertices
+      if (chunk.dirty) {
+        chunk.vertex_buffer->SetData(chunk.vertices.data(), (uint32_t)(chunk.vertices.size() * sizeof(Vertex)));
+        chunk.dirty = false;
+        stats.stats_2d_.static_chunk_uploads++;
+
+        glm::vec2 min_bound(std::numeric_limits<float>::max()), max_bound(std::numeric_limits<float>::lowest());
+        for (const auto& vertex : chunk.vertices) {
+          min_bound = glm::min(min_bound, glm::vec2(vertex.position));
+          max_bound = glm::max(max_bound, glm::vec2(vertex.position));
+        }
+        chunk.bounds = { min_bound, max_bound };
+      }
+
+      // Textures of culled chunk are kept resident, so that chunk does not render the placeholder when it comes back in view
+      if (view_bounds and (chunk.bounds.z < view_bounds->x or chunk.bounds.x > view_bounds->z or
+                           chunk.bounds.w < view_bounds->y or chunk.bounds.y > view_bounds->w)) {
+        for (uint32_t i = 1; i < chunk.num_textures; i++)
+          chunk.textures[i].MarkInUse();
+        continue;
+      }
+
+      for (uint32_t i = 0; i < chunk.num_textures; i++) {
+        // Texture destroyed after submission is drawn white until the quad is submitted again
+        Texture* texture = chunk.textures[i].Get();
+        (texture ? texture : white_texture_.get())->Bind(i);
+      }
+
+      uint32_t num_quads = (uint32_t)chunk.keys.size();
+      Renderer::DrawIndexed(chunk.pipeline, num_quads * IndicesForSingleQuad);
+
+      stats.index_count += num_quads * IndicesForSingleQuad;
+      stats.vertex_count += num_quads * VertexForSingleQuad;
+      stats.stats_2d_.static_quads += num_quads;
+      rendered_quads += num_quads;
+    }
+    return rendered_quads;
+  }
+
+} // namespace ikan
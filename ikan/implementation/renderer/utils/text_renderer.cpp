@@ -12,6 +12,10 @@
 #include "renderer/utils/renderer.hpp"
 #include "renderer/utils/renderer_stats.hpp"
 
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 namespace ikan {
   
   struct TextData {
@@ -24,8 +28,81 @@ namespace ikan {
       int32_t object_id;
     };
     
+    /// Metrics and location of a glyph in atlas. Metrics are in pixels of its size bucket
+    struct Glyph {
+      glm::ivec2 size = {0, 0};
+      glm::ivec2 bearing = {0, 0};
+      uint32_t advance = 0;
+      /// Texture coordinates of glyph in atlas page (min u, min v, max u, max v). Min v is the top row of glyph
+      glm::vec4 uv_rect = {0.0f, 0.0f, 0.0f, 0.0f};
+      /// Atlas page (texture slot) of glyph
+      uint32_t page = 0;
+      /// False till glyph is rasterized by worker thread
+      bool loaded = false;
+    };
+    
+    /// Rows (shelves) of glyphs packed in atlas page
+    struct Shelf {
+      glm::ivec2 cursor = {0, 0};
+      int32_t row_height = 0;
+    };
+    
+    /// Atlas page storing the glyphs of single size bucket
+    struct AtlasPage {
+      std::shared_ptr<CharTexture> texture;
+      uint32_t bucket = 0;
+      Shelf shelf;
+      uint32_t last_used_frame = 0;
+    };
+    
+    /// Glyph rasterized by worker thread, waiting to be packed in atlas
+    struct RasterizedGlyph {
+      uint64_t key = 0;
+      uint32_t font_version = 0;
+      glm::ivec2 size = {0, 0};
+      glm::ivec2 bearing = {0, 0};
+      uint32_t advance = 0;
+      std::vector<uint8_t> pixels;
+    };
+    
+    /// Quad of a glyph in text layout. Position is in base glyph pixels relative to text origin, so layout is same for any scale
+    struct LayoutQuad {
+      glm::vec4 rect;     // min x, min y, max x, max y
+      glm::vec4 uv_rect;  // min u, min v, max u, max v
+      float page;
+    };
+    
+    /// Pre built glyph quads of a text
+    struct TextLayout {
+      std::string text;
+      std::vector<LayoutQuad> quads;
+      uint32_t bucket = 0;
+      /// Glyph generation used to build the layout. Layout is rebuilt if glyphs are added or evicted after it
+      uint32_t generation = 0;
+      /// Bit mask of atlas pages used by layout
+      uint32_t pages = 0;
+      uint32_t last_used_frame = 0;
+    };
+    
     // Fixed Constants
     static constexpr uint32_t VertexForSingleChar = 6;
+    static constexpr uint32_t MaxCharsPerBatch = 4096;
+    /// Layouts not used in this many frames are removed from cache
+    static constexpr uint32_t LayoutCacheFrames = 256;
+    static constexpr uint32_t MaxVertices = MaxCharsPerBatch * VertexForSingleChar;
+    /// Pixel sizes of glyphs. Text is rendered with smallest bucket not smaller than its size on screen
+    static constexpr std::array<uint32_t, 6> SizeBuckets = { 16, 24, 32, 48, 64, 96 };
+    /// Bucket of GlyphPixelSize. Text positions and scales are in pixels of this bucket
+    static constexpr uint32_t BaseBucket = 3;
+    static constexpr uint32_t GlyphPixelSize = SizeBuckets[BaseBucket];
+    /// ASCII glyphs of base bucket are rasterized when font is loaded (and cached on disk)
+    static constexpr uint32_t NumGlyphs = 128;
+    static constexpr int32_t AtlasPageSize = 1024;
+    /// Empty pixels between glyphs in atlas, so that linear filter do not sample neighbour glyph
+    static constexpr int32_t AtlasPadding = 1;
+    static constexpr size_t AtlasPageBytes = (size_t)AtlasPageSize * AtlasPageSize;
+    static constexpr size_t DefaultGlyphCacheBudget = 8 * AtlasPageBytes;
+    static_assert(MaxTextureSlotsInShader <= 32, "Atlas pages of layout are stored in 32 bit mask");
     
     std::string font;
     
@@ -34,39 +111,69 @@ namespace ikan {
     std::shared_ptr<VertexBuffer> vertex_buffer;
     std::shared_ptr<Shader> shader;
     
-    std::array<std::shared_ptr<CharTexture>, MaxTextureSlotsInShader> char_textures;
+    /// Glyph atlas pages. Page index is the texture slot in shader
+    std::vector<AtlasPage> atlas_pages;
+    /// Max atlas pages in memory budget. Least recently used page is evicted to store new glyphs
+    uint32_t max_atlas_pages = 1;
+    /// Glyphs keyed by size bucket (high 32 bits) and unicode code point (low 32 bits)
+    std::unordered_map<uint64_t, Glyph> glyphs;
+    /// Incremented each time glyphs are added or evicted
+    uint32_t glyph_generation = 0;
     
-    /// Map to store the Char Texture for each character
-    std::map<char, std::shared_ptr<CharTexture>> char_texture_map;
+    /// Cache of text layouts, keyed by hash of text and size bucket. Cleared when font changes
+    std::unordered_map<size_t, TextLayout> layout_cache;
+    /// Frame counter to remove the layouts and atlas pages not used recently
+    uint32_t frame = 0;
+    /// Camera of current batch, to compute the size of text on screen
+    glm::mat4 view_projection = glm::mat4(1.0f);
+    
+    /// Serial queue rasterizing the glyphs with its own freetype face. Face is only accessed in this queue
+    dispatch_queue_t raster_queue = nullptr;
+    FT_Library raster_library = nullptr;
+    FT_Face raster_face = nullptr;
+    /// Incremented when font changes, to drop the glyphs of old font still in queue
+    uint32_t font_version = 0;
+    /// Glyphs rasterized by queue, packed in atlas at the begining of next batch
+    std::mutex raster_mutex;
+    std::vector<RasterizedGlyph> rasterized;
     
     /// Base pointer of Vertex Data. This is start of Batch data for single draw call
     Vertex* vertex_buffer_base_ptr = nullptr;
     /// Incrememntal Vetrtex Data Pointer to store all the batch data in Buffer
     Vertex* vertex_buffer_ptr = nullptr;
     
-    /// Store the Base Texture coordinga
-    glm::vec2 base_texture_coords[VertexForSingleChar];
-    
-    uint32_t num_slots_used = 0;
+    uint32_t vertex_count = 0;
     
     virtual ~TextData() {
       delete [] vertex_buffer_base_ptr;
       vertex_buffer_base_ptr = nullptr;
+      
+      // Wait for the pending glyphs and destroy the face of raster queue
+      if (raster_queue) {
+        TextData* data = this;
+        dispatch_sync(raster_queue, ^{
+          if (data->raster_face) FT_Done_Face(data->raster_face);
+          if (data->raster_library) FT_Done_FreeType(data->raster_library);
+        });
+        dispatch_release(raster_queue);
+      }
     }
   };
   static std::unique_ptr<TextData> text_data_;
+  /// Memory budget of glyph atlas pages. Kept outside text data so that it stays same if renderer is initialised again
+  static size_t glyph_cache_budget_ = TextData::DefaultGlyphCacheBudget;
 
   void TextRenderer::Initialise(const std::string& font_file_path) {
     text_data_ = std::make_unique<TextData>();
     
     // Allocating the memory for vertex Buffer Pointer
-    text_data_->vertex_buffer_base_ptr = new TextData::Vertex[TextData::VertexForSingleChar * MaxTextureSlotsInShader];
+    text_data_->vertex_buffer_base_ptr = new TextData::Vertex[TextData::MaxVertices];
     
     // Create Pipeline instance
     text_data_->pipeline = Pipeline::Create();
     
     // Create vertes Buffer
-    text_data_->vertex_buffer = VertexBuffer::Create(sizeof(TextData::Vertex) * TextData::VertexForSingleChar * MaxTextureSlotsInShader);
+    text_data_->vertex_buffer = VertexBuffer::Create(sizeof(TextData::Vertex) * TextData::MaxVertices);
     text_data_->vertex_buffer->AddLayout({
       { "a_Position",  ShaderDataType::Float3 },
       { "a_Color",     ShaderDataType::Float4 },
@@ -79,18 +186,15 @@ namespace ikan {
     // Settingup shader
     text_data_->shader = Renderer::GetShader(DirectoryManager::CoreAsset("shaders/text_shader.glsl"));
     
-    // Base Texture coordinate for Char rendering
-    text_data_->base_texture_coords[0] = { 0.0f, 0.0f };
-    text_data_->base_texture_coords[1] = { 0.0f, 1.0f };
-    text_data_->base_texture_coords[2] = { 1.0f, 1.0f };
-    text_data_->base_texture_coords[3] = { 0.0f, 0.0f };
-    text_data_->base_texture_coords[4] = { 1.0f, 1.0f };
-    text_data_->base_texture_coords[5] = { 1.0f, 0.0f };
+    // Glyph cache
+    text_data_->raster_queue = dispatch_queue_create("ikan.text_renderer.rasterizer", DISPATCH_QUEUE_SERIAL);
+    SetGlyphCacheBudget(glyph_cache_budget_);
     
     IK_CORE_TRACE(LogModule::TextRenderer, "Initialised the Text Renderer");
-    IK_CORE_TRACE(LogModule::TextRenderer, "  Vertex Buffer Used  {0} B",
-                  TextData::VertexForSingleChar * sizeof(TextData::Vertex) * MaxTextureSlotsInShader);
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Max Chars per Batch {0}", TextData::MaxCharsPerBatch);
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Vertex Buffer Used  {0} B", TextData::MaxVertices * sizeof(TextData::Vertex));
     IK_CORE_TRACE(LogModule::TextRenderer, "  Shader used         {0}", text_data_->shader->GetName());
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Glyph Cache Budget  {0} B ({1} Pages)", glyph_cache_budget_, text_data_->max_atlas_pages);
     
     if (font_file_path != "") {
       LoadFreetype(font_file_path);
@@ -101,57 +205,433 @@ namespace ikan {
     if (!text_data_) return;
     
     IK_CORE_TRACE(LogModule::TextRenderer, "Shutting down the Text Renderer !!!");
-    IK_CORE_TRACE(LogModule::TextRenderer, "  Vertex Buffer Used  {0} B",
-                  TextData::VertexForSingleChar * sizeof(TextData::Vertex) * MaxTextureSlotsInShader);
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Vertex Buffer Used  {0} B", TextData::MaxVertices * sizeof(TextData::Vertex));
     IK_CORE_TRACE(LogModule::TextRenderer, "  Shader used         {0}", text_data_->shader->GetName());
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Atlas Pages         {0}", text_data_->atlas_pages.size());
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Glyphs              {0}", text_data_->glyphs.size());
     
     text_data_.reset();
   }
   
-  void TextRenderer::LoadFreetype(const std::string& font_file_path) {
-    IK_CORE_TRACE(LogModule::TextRenderer, "Loading the Font for Text renderer '{0}'", font_file_path.c_str());
+  /// This function returns the key of glyph in glyph map
+  /// - Parameters:
+  ///   - bucket: size bucket
+  ///   - code_point: unicode code point
+  static uint64_t GetGlyphKey(uint32_t bucket, uint32_t code_point) {
+    return ((uint64_t)bucket << 32) | code_point;
+  }
+  
+  /// This function returns the empty pixels of atlas page
+  static const uint8_t* GetEmptyPagePixels() {
+    static const std::vector<uint8_t> empty_pixels(TextData::AtlasPageBytes, 0);
+    return empty_pixels.data();
+  }
+  
+  /// This function finds the space for glyph in shelves of page. Returns false if page is full
+  /// - Parameters:
+  ///   - shelf: shelf state of page
+  ///   - size: size of glyph
+  ///   - offset: offset of glyph in page (output)
+  static bool PackInShelf(TextData::Shelf& shelf, const glm::ivec2& size, glm::ivec2& offset) {
+    glm::ivec2 cursor = shelf.cursor;
+    int32_t row_height = shelf.row_height;
+    
+    // Move to next row if glyph do not fit in current row
+    if (cursor.x + size.x > TextData::AtlasPageSize) {
+      cursor = { 0, cursor.y + row_height + TextData::AtlasPadding };
+      row_height = 0;
+    }
+    if (cursor.y + size.y > TextData::AtlasPageSize)
+      return false;
+    
+    offset = cursor;
+    shelf.cursor = { cursor.x + size.x + TextData::AtlasPadding, cursor.y };
+    shelf.row_height = std::max(row_height, size.y);
+    return true;
+  }
+  
+  /// Header of glyph atlas cache file. File stores header, then glyphs and then the pixels of all pages
+  struct GlyphCacheHeader {
+    static constexpr uint32_t Magic = 0x4B47494B; // "IKGK"
+    static constexpr uint32_t Version = 1;
+    
+    uint32_t magic = Magic;
+    uint32_t version = Version;
+    uint64_t font_hash = 0;
+    uint32_t pixel_size = TextData::GlyphPixelSize;
+    uint32_t page_size = TextData::AtlasPageSize;
+    uint32_t glyph_size = sizeof(TextData::Glyph);
+    uint32_t num_glyphs = TextData::NumGlyphs;
+    uint32_t num_pages = 0;
+  };
+  using AsciiGlyphs = std::array<TextData::Glyph, TextData::NumGlyphs>;
+  
+  /// This function returns the FNV-1a hash of file content. Returns 0 if file can not be read
+  /// - Parameter file_path: path of file
+  static uint64_t HashFile(const std::string& file_path) {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file)
+      return 0;
+    
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : content) {
+      hash ^= (uint8_t)c;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+  
+  /// This function returns the path of glyph atlas cache of font. Cache is stored in cache folder (not in tracked font folder)
+  /// - Parameter font_file_path: path of font
+  static std::string GetGlyphCachePath(const std::string& font_file_path) {
+    return DM::CacheFile(font_file_path, "." + std::to_string(TextData::GlyphPixelSize) + ".ikglyph");
+  }
+  
+  /// This function loads the glyphs and atlas pages from cache file with single read. Returns false if cache is missing or stale
+  /// - Parameters:
+  ///   - cache_path: path of cache file
+  ///   - font_hash: hash of font file
+  ///   - glyphs: ASCII glyphs (output)
+  ///   - pages: pixels of atlas pages (output)
+  static bool LoadGlyphCache(const std::string& cache_path, uint64_t font_hash, AsciiGlyphs& glyphs, std::vector<std::vector<uint8_t>>& pages) {
+    std::ifstream file(cache_path, std::ios::binary | std::ios::ate);
+    if (!file)
+      return false;
     
+    std::vector<uint8_t> content((size_t)file.tellg());
+    file.seekg(0);
+    if (!file.read((char*)content.data(), (std::streamsize)content.size()))
+      return false;
+    if (content.size() < sizeof(GlyphCacheHeader))
+      return false;
+    
+    // Validate the cache with font hash and layout of data
+    GlyphCacheHeader header;
+    memcpy(&header, content.data(), sizeof(GlyphCacheHeader));
+    const GlyphCacheHeader expected;
+    if (header.magic != expected.magic or header.version != expected.version or header.font_hash != font_hash or
+        header.pixel_size != expected.pixel_size or header.page_size != expected.page_size or header.glyph_size != expected.glyph_size or
+        header.num_glyphs != expected.num_glyphs or header.num_pages == 0 or header.num_pages > MaxTextureSlotsInShader) {
+      return false;
+    }
+    
+    const size_t glyph_bytes = sizeof(TextData::Glyph) * TextData::NumGlyphs;
+    if (content.size() != sizeof(GlyphCacheHeader) + glyph_bytes + TextData::AtlasPageBytes * header.num_pages)
+      return false;
+    
+    const uint8_t* data = content.data() + sizeof(GlyphCacheHeader);
+    memcpy(glyphs.data(), data, glyph_bytes);
+    data += glyph_bytes;
+    
+    pages.resize(header.num_pages);
+    for (auto& page : pages) {
+      page.assign(data, data + TextData::AtlasPageBytes);
+      data += TextData::AtlasPageBytes;
+    }
+    return true;
+  }
+  
+  /// This function writes the glyphs and atlas pages in cache file. Written in temporary file first, so that interrupted write never
+  /// leaves a partial cache
+  /// - Parameters:
+  ///   - cache_path: path of cache file
+  ///   - font_hash: hash of font file
+  ///   - glyphs: ASCII glyphs
+  ///   - pages: pixels of atlas pages
+  static void SaveGlyphCache(const std::string& cache_path, uint64_t font_hash, const AsciiGlyphs& glyphs,
+                             const std::vector<std::vector<uint8_t>>& pages) {
+    std::string temp_path = cache_path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+      std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+      if (!file) {
+        IK_CORE_WARN(LogModule::TextRenderer, "Can not write the Glyph cache '{0}'", cache_path.c_str());
+        return;
+      }
+      
+      GlyphCacheHeader header;
+      header.font_hash = font_hash;
+      header.num_pages = (uint32_t)pages.size();
+      file.write((const char*)&header, sizeof(GlyphCacheHeader));
+      file.write((const char*)glyphs.data(), sizeof(TextData::Glyph) * TextData::NumGlyphs);
+      for (const auto& page : pages)
+        file.write((const char*)page.data(), (std::streamsize)page.size());
+    }
+    std::rename(temp_path.c_str(), cache_path.c_str());
+  }
+  
+  /// This function rasterizes the ASCII glyphs of base bucket with freetype and packs them in atlas pages
+  /// - Parameters:
+  ///   - font_file_path: path of font
+  ///   - glyphs: ASCII glyphs (output)
+  ///   - pages: pixels of atlas pages (output)
+  static void RasterizeGlyphs(const std::string& font_file_path, AsciiGlyphs& glyphs, std::vector<std::vector<uint8_t>>& pages) {
     FT_Library ft;
     IK_CORE_ASSERT(!FT_Init_FreeType(&ft), "Not able to load Freetype");
     
-    // find path to font
-    IK_CORE_ASSERT(!font_file_path.empty(), "Not able to load Font");
-    
     // load font as face
     FT_Face face;
     IK_CORE_ASSERT(!FT_New_Face(ft, font_file_path.c_str(), 0, &face), "Unavle to load tha font to freetype");
     // set size to load glyphs as
-    FT_Set_Pixel_Sizes(face, 0, 48);
+    FT_Set_Pixel_Sizes(face, 0, TextData::GlyphPixelSize);
+    
+    // Pack the glyphs in rows (shelves) of atlas page. New page is started when current page is full
+    pages.emplace_back(TextData::AtlasPageBytes, 0);
+    TextData::Shelf shelf;
     
     // load first 128 characters of ASCII set
-    for (unsigned char c = 0; c < 128; c++) {
+    for (unsigned char c = 0; c < TextData::NumGlyphs; c++) {
       // Load character glyph
       if (FT_Load_Char(face, c, FT_LOAD_RENDER)){
         IK_CORE_CRITICAL(LogModule::TextRenderer, "ERROR::FREETYTPE: Failed to load Glyph");
         continue;
       }
+      
+      const FT_Bitmap& bitmap = face->glyph->bitmap;
+      const glm::ivec2 size = { (int32_t)bitmap.width, (int32_t)bitmap.rows };
+      IK_CORE_ASSERT(size.x <= TextData::AtlasPageSize and size.y <= TextData::AtlasPageSize, "Glyph is bigger than atlas page");
+      
+      // Move to next page if glyph do not fit
+      glm::ivec2 offset;
+      if (!PackInShelf(shelf, size, offset)) {
+        pages.emplace_back(TextData::AtlasPageBytes, 0);
+        shelf = {};
+        PackInShelf(shelf, size, offset);
+      }
+      
+      // Copy the glyph bitmap in page
+      auto& page_pixels = pages.back();
+      for (int32_t row = 0; row < size.y; row++) {
+        memcpy(&page_pixels[(offset.y + row) * TextData::AtlasPageSize + offset.x], bitmap.buffer + row * bitmap.pitch, size.x);
+      }
+      
       // now store character for later use
-      std::shared_ptr<CharTexture> char_texture = CharTexture::Create(face,
-                                                                      glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-                                                                      glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-                                                                      static_cast<uint32_t>(face->glyph->advance.x),
-                                                                      char(c));
-      text_data_->char_texture_map.insert(std::pair<char, std::shared_ptr<CharTexture>>(c, char_texture));
+      auto& glyph = glyphs[c];
+      glyph.size = size;
+      glyph.bearing = { face->glyph->bitmap_left, face->glyph->bitmap_top };
+      glyph.advance = static_cast<uint32_t>(face->glyph->advance.x);
+      glyph.page = (uint32_t)pages.size() - 1;
+      glyph.uv_rect = glm::vec4(offset.x, offset.y, offset.x + size.x, offset.y + size.y) / (float)TextData::AtlasPageSize;
+      glyph.loaded = true;
     }
     
     // destroy FreeType once we're finished
     FT_Done_Face(face);
     FT_Done_FreeType(ft);
+  }
+  
+  /// This function requests the glyph to be rasterized in raster queue. Glyph is stored as not loaded till the result is packed in
+  /// atlas (at the begining of next batch)
+  /// - Parameter key: key of glyph
+  static void RequestGlyph(uint64_t key) {
+    text_data_->glyphs.emplace(key, TextData::Glyph());
+    
+    TextData* data = text_data_.get();
+    const uint32_t font_version = data->font_version;
+    dispatch_async(data->raster_queue, ^{
+      TextData::RasterizedGlyph result;
+      result.key = key;
+      result.font_version = font_version;
+      
+      FT_Face face = data->raster_face;
+      if (face) {
+        FT_Set_Pixel_Sizes(face, 0, TextData::SizeBuckets[key >> 32]);
+        if (!FT_Load_Char(face, (FT_ULong)(key & 0xFFFFFFFF), FT_LOAD_RENDER)) {
+          const FT_Bitmap& bitmap = face->glyph->bitmap;
+          result.bearing = { face->glyph->bitmap_left, face->glyph->bitmap_top };
+          result.advance = static_cast<uint32_t>(face->glyph->advance.x);
+          
+          // Glyphs bigger than atlas page are only advanced
+          if ((int32_t)bitmap.width <= TextData::AtlasPageSize and (int32_t)bitmap.rows <= TextData::AtlasPageSize) {
+            result.size = { (int32_t)bitmap.width, (int32_t)bitmap.rows };
+            result.pixels.resize((size_t)result.size.x * result.size.y);
+            for (int32_t row = 0; row < result.size.y; row++)
+              memcpy(&result.pixels[row * result.size.x], bitmap.buffer + row * bitmap.pitch, result.size.x);
+          }
+        }
+      }
+      
+      std::scoped_lock lock(data->raster_mutex);
+      data->rasterized.push_back(std::move(result));
+    });
+  }
+  
+  /// This function removes all the glyphs of page and gives the page to other bucket
+  /// - Parameters:
+  ///   - page_idx: index of page
+  ///   - bucket: new bucket of page
+  static void EvictAtlasPage(uint32_t page_idx, uint32_t bucket) {
+    std::erase_if(text_data_->glyphs, [page_idx](const auto& entry) {
+      const auto& glyph = entry.second;
+      return glyph.loaded and glyph.size.x > 0 and glyph.size.y > 0 and glyph.page == page_idx;
+    });
+    
+    auto& page = text_data_->atlas_pages[page_idx];
+    page.texture->SetSubData({0, 0}, {TextData::AtlasPageSize, TextData::AtlasPageSize}, GetEmptyPagePixels());
+    page.bucket = bucket;
+    page.shelf = {};
+    text_data_->glyph_generation++;
+  }
+  
+  /// This function returns the page having space for glyph of bucket. Creates new page if budget allows, else evicts least recently
+  /// used page. Returns -1 if all pages are used in current frame
+  /// - Parameters:
+  ///   - bucket: size bucket of glyph
+  ///   - size: size of glyph
+  ///   - offset: offset of glyph in page (output)
+  static int32_t GetAtlasPage(uint32_t bucket, const glm::ivec2& size, glm::ivec2& offset) {
+    auto& pages = text_data_->atlas_pages;
+    for (uint32_t i = 0; i < pages.size(); i++) {
+      if (pages[i].bucket == bucket and PackInShelf(pages[i].shelf, size, offset)) {
+        pages[i].last_used_frame = text_data_->frame;
+        return (int32_t)i;
+      }
+    }
+    
+    int32_t page_idx = -1;
+    if (pages.size() < text_data_->max_atlas_pages) {
+      auto& page = pages.emplace_back();
+      page.texture = CharTexture::Create({TextData::AtlasPageSize, TextData::AtlasPageSize}, GetEmptyPagePixels());
+      page.bucket = bucket;
+      page_idx = (int32_t)pages.size() - 1;
+    }
+    else {
+      for (uint32_t i = 0; i < pages.size(); i++) {
+        if (pages[i].last_used_frame != text_data_->frame and
+            (page_idx < 0 or pages[i].last_used_frame < pages[page_idx].last_used_frame)) {
+          page_idx = (int32_t)i;
+        }
+      }
+      if (page_idx < 0)
+        return -1;
+      EvictAtlasPage((uint32_t)page_idx, bucket);
+    }
+    
+    pages[page_idx].last_used_frame = text_data_->frame;
+    PackInShelf(pages[page_idx].shelf, size, offset);
+    return page_idx;
+  }
+  
+  /// This function packs the glyphs rasterized by raster queue in atlas pages
+  static void StoreRasterizedGlyphs() {
+    std::vector<TextData::RasterizedGlyph> rasterized;
+    {
+      std::scoped_lock lock(text_data_->raster_mutex);
+      rasterized.swap(text_data_->rasterized);
+    }
+    RETURN_IF(rasterized.empty());
+    
+    for (const auto& result : rasterized) {
+      // Skip the glyphs of old font or removed from cache
+      auto it = text_data_->glyphs.find(result.key);
+      if (result.font_version != text_data_->font_version or it == text_data_->glyphs.end() or it->second.loaded)
+        continue;
+      
+      auto& glyph = it->second;
+      glyph.size = result.size;
+      glyph.bearing = result.bearing;
+      glyph.advance = result.advance;
+      
+      if (glyph.size.x > 0 and glyph.size.y > 0) {
+        glm::ivec2 offset;
+        int32_t page_idx = GetAtlasPage((uint32_t)(result.key >> 32), glyph.size, offset);
+        if (page_idx < 0) {
+          // All pages are used in this frame. Glyph will be requested again
+          text_data_->glyphs.erase(it);
+          continue;
+        }
+        
+        text_data_->atlas_pages[page_idx].texture->SetSubData(offset, glyph.size, result.pixels.data());
+        glyph.page = (uint32_t)page_idx;
+        glyph.uv_rect = glm::vec4(offset.x, offset.y, offset.x + glyph.size.x, offset.y + glyph.size.y) / (float)TextData::AtlasPageSize;
+      }
+      glyph.loaded = true;
+    }
+    text_data_->glyph_generation++;
+  }
+  
+  void TextRenderer::LoadFreetype(const std::string& font_file_path) {
+    IK_CORE_TRACE(LogModule::TextRenderer, "Loading the Font for Text renderer '{0}'", font_file_path.c_str());
+    
+    // find path to font
+    IK_CORE_ASSERT(!font_file_path.empty(), "Not able to load Font");
+    
+    [[maybe_unused]] auto start_time = std::chrono::steady_clock::now();
+    
+    // Remove the glyphs (and layouts) of previous font
+    text_data_->atlas_pages.clear();
+    text_data_->glyphs.clear();
+    text_data_->layout_cache.clear();
+    text_data_->font_version++;
+    text_data_->glyph_generation++;
+    
+    // Open the font in raster queue, for glyphs loaded on demand
+    TextData* data = text_data_.get();
+    const std::string font_path = font_file_path;
+    dispatch_async(data->raster_queue, ^{
+      if (data->raster_face) FT_Done_Face(data->raster_face);
+      if (!data->raster_library and FT_Init_FreeType(&data->raster_library))
+        data->raster_library = nullptr;
+      if (!data->raster_library or FT_New_Face(data->raster_library, font_path.c_str(), 0, &data->raster_face))
+        data->raster_face = nullptr;
+    });
+    
+    // Load the rasterized ASCII glyphs from cache if font is not changed, else rasterize and cache them
+    const uint64_t font_hash = HashFile(font_file_path);
+    const std::string cache_path = GetGlyphCachePath(font_file_path);
+    AsciiGlyphs ascii_glyphs;
+    std::vector<std::vector<uint8_t>> pages;
+    const bool from_cache = LoadGlyphCache(cache_path, font_hash, ascii_glyphs, pages);
+    if (!from_cache) {
+      ascii_glyphs = {};
+      pages.clear();
+      RasterizeGlyphs(font_file_path, ascii_glyphs, pages);
+      SaveGlyphCache(cache_path, font_hash, ascii_glyphs, pages);
+    }
+    IK_CORE_ASSERT(pages.size() <= text_data_->max_atlas_pages, "Glyph atlas pages are more than glyph cache budget");
+    
+    // Pre loaded pages are not packed any more
+    for (const auto& page_pixels : pages) {
+      auto& page = text_data_->atlas_pages.emplace_back();
+      page.texture = CharTexture::Create({TextData::AtlasPageSize, TextData::AtlasPageSize}, page_pixels.data());
+      page.bucket = TextData::BaseBucket;
+      page.shelf.cursor = { 0, TextData::AtlasPageSize };
+    }
+    for (uint32_t c = 0; c < TextData::NumGlyphs; c++) {
+      if (ascii_glyphs[c].loaded)
+        text_data_->glyphs.emplace(GetGlyphKey(TextData::BaseBucket, c), ascii_glyphs[c]);
+    }
     
     text_data_->font = font_file_path;
+    
+    [[maybe_unused]] auto load_time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Glyph Atlas Pages   {0} ({1} x {1})", text_data_->atlas_pages.size(), TextData::AtlasPageSize);
+    IK_CORE_TRACE(LogModule::TextRenderer, "  Glyph Cache         {0}", cache_path.c_str());
+    IK_CORE_INFO(LogModule::TextRenderer, "Loaded Font '{0}' in {1} ms ({2} glyph cache)", StringUtils::GetNameFromFilePath(font_file_path),
+                 load_time, from_cache ? "Warm" : "Cold");
+  }
+  
+  void TextRenderer::SetGlyphCacheBudget(size_t budget) {
+    glyph_cache_budget_ = budget;
+    RETURN_IF(!text_data_);
+    
+    text_data_->max_atlas_pages = std::clamp((uint32_t)(budget / TextData::AtlasPageBytes), 1u, (uint32_t)MaxTextureSlotsInShader);
+    
+    // Pages can not be removed from middle as page is the texture slot, so the cache is rebuilt on demand
+    if (text_data_->atlas_pages.size() > text_data_->max_atlas_pages) {
+      text_data_->atlas_pages.clear();
+      std::erase_if(text_data_->glyphs, [](const auto& entry) { return entry.second.loaded; });
+      text_data_->glyph_generation++;
+    }
   }
   
   void TextRenderer::LogData() {
     IK_CORE_INFO(LogModule::TextRenderer,"    Text Renderer Data ...");
     
-    IK_CORE_INFO(LogModule::TextRenderer,"        Unique characters per Batch       | {0}", MaxTextureSlotsInShader);
-    IK_CORE_INFO(LogModule::TextRenderer,"        Vertex Buffer Used                | {0} B",
-                TextData::VertexForSingleChar * sizeof(TextData::Vertex) * MaxTextureSlotsInShader);
+    IK_CORE_INFO(LogModule::TextRenderer,"        Characters per Batch              | {0}", TextData::MaxCharsPerBatch);
+    IK_CORE_INFO(LogModule::TextRenderer,"        Vertex Buffer Used                | {0} B", TextData::MaxVertices * sizeof(TextData::Vertex));
+    IK_CORE_INFO(LogModule::TextRenderer,"        Glyph Atlas Pages                 | {0} / {1}", text_data_->atlas_pages.size(), text_data_->max_atlas_pages);
+    IK_CORE_INFO(LogModule::TextRenderer,"        Glyphs                            | {0}", text_data_->glyphs.size());
     IK_CORE_INFO(LogModule::TextRenderer,"        Shader used                       | {0}", text_data_->shader->GetName());
     IK_CORE_INFO(LogModule::TextRenderer,"        Font used                         | {0}", text_data_->font.c_str());
   }
@@ -160,18 +640,31 @@ namespace ikan {
     // Update camera to shader
     text_data_->shader->Bind();
     text_data_->shader->SetUniformMat4("v_Projection", camera_view_projection_matrix);
+    text_data_->view_projection = camera_view_projection_matrix;
+    
+    // Remove the layouts of texts not rendered recently (e.g. old values of changing text)
+    if (++text_data_->frame % TextData::LayoutCacheFrames == 0) {
+      std::erase_if(text_data_->layout_cache, [](const auto& entry) {
+        return text_data_->frame - entry.second.last_used_frame >= TextData::LayoutCacheFrames;
+      });
+    }
+    
+    // Add the glyphs rasterized since last batch
+    StoreRasterizedGlyphs();
     
     NextBatch();
   }
   void TextRenderer::EndBatch() {
+    RETURN_IF(text_data_->vertex_count == 0);
+    
     uint32_t dataSize = (uint32_t)((uint8_t*)text_data_->vertex_buffer_ptr - (uint8_t*)text_data_->vertex_buffer_base_ptr);
     text_data_->vertex_buffer->SetData(text_data_->vertex_buffer_base_ptr, dataSize);
     
     // Render the Scene
     text_data_->shader->Bind();
-    for (int j = 0; j < text_data_->num_slots_used; j ++)
-      text_data_->char_textures[j]->Bind(j);
-    Renderer::DrawArrays(text_data_->pipeline, 6 * text_data_->num_slots_used);
+    for (uint32_t page = 0; page < text_data_->atlas_pages.size(); page++)
+      text_data_->atlas_pages[page].texture->Bind(page);
+    Renderer::DrawArrays(text_data_->pipeline, text_data_->vertex_count);
   }
 
   void TextRenderer::Flush() {
@@ -181,67 +674,167 @@ namespace ikan {
   
   void TextRenderer::NextBatch() {
     text_data_->vertex_buffer_ptr = text_data_->vertex_buffer_base_ptr;
-    text_data_->num_slots_used = 0;
+    text_data_->vertex_count = 0;
   }
 
-  void TextRenderer::RenderFixedViewText(std::string text, glm::vec3 position, const glm::vec2& scale, const glm::vec4& color) {
+  void TextRenderer::RenderFixedViewText(const std::string& text, const glm::vec3& position, const glm::vec2& scale, const glm::vec4& color) {
     RenderTextImpl(text, position, scale, color);
   }
   
-  void TextRenderer::RenderText(std::string text, glm::vec3 position, const glm::vec2& original_scale, const glm::vec4& color) {
+  void TextRenderer::RenderText(const std::string& text, const glm::vec3& position, const glm::vec2& original_scale, const glm::vec4& color) {
     glm::vec2 scale = { original_scale.x * 0.035, original_scale.y * 0.035 };
     RenderTextImpl(text, position, scale, color);
   }
   
-  void TextRenderer::RenderTextImpl(std::string text, glm::vec3 position, const glm::vec2& scale, const glm::vec4& color) {
-    float a = 0.0f;
-    for (std::string::const_iterator c = text.begin(); c != text.end(); c++) {
-      if (text_data_->num_slots_used >= MaxTextureSlotsInShader) {
+  /// This function decodes the next code point of UTF-8 text. Invalid bytes are decoded as replacement character (U+FFFD)
+  /// - Parameters:
+  ///   - text: UTF-8 text
+  ///   - idx: index of first byte of code point. Moved to next code point
+  static uint32_t DecodeUTF8(const std::string& text, size_t& idx) {
+    static constexpr uint32_t ReplacementChar = 0xFFFD;
+    
+    const uint8_t lead = (uint8_t)text[idx++];
+    if (lead < 0x80)
+      return lead;
+    
+    // Number of continuation bytes and bits of lead byte
+    uint32_t num_bytes = 0, code_point = 0, min_code_point = 0;
+    if ((lead & 0xE0) == 0xC0)      { num_bytes = 1; code_point = lead & 0x1F; min_code_point = 0x80; }
+    else if ((lead & 0xF0) == 0xE0) { num_bytes = 2; code_point = lead & 0x0F; min_code_point = 0x800; }
+    else if ((lead & 0xF8) == 0xF0) { num_bytes = 3; code_point = lead & 0x07; min_code_point = 0x10000; }
+    else
+      return ReplacementChar;
+    
+    for (uint32_t i = 0; i < num_bytes; i++) {
+      if (idx >= text.size() or ((uint8_t)text[idx] & 0xC0) != 0x80)
+        return ReplacementChar;
+      code_point = (code_point << 6) | ((uint8_t)text[idx++] & 0x3F);
+    }
+    
+    // Reject over long encodings, surrogates and out of range values
+    if (code_point < min_code_point or code_point > 0x10FFFF or (code_point >= 0xD800 and code_point <= 0xDFFF))
+      return ReplacementChar;
+    return code_point;
+  }
+  
+  /// This function returns the size bucket of text, from its glyph size in pixels on screen
+  /// - Parameters:
+  ///   - position: position of text
+  ///   - scale: scale of text
+  static uint32_t GetSizeBucket(const glm::vec3& position, const glm::vec2& scale) {
+    const auto& viewport = Renderer::GetViewportSize();
+    const glm::mat4& view_projection = text_data_->view_projection;
+    const float w = (view_projection * glm::vec4(position, 1.0f)).w;
+    if (viewport.y == 0 or w <= 0.0f)
+      return TextData::BaseBucket;
+    
+    const float pixel_size = std::abs(view_projection[1][1] * scale.y) * TextData::GlyphPixelSize / w * viewport.y * 0.5f;
+    for (uint32_t bucket = 0; bucket < TextData::SizeBuckets.size(); bucket++) {
+      if (TextData::SizeBuckets[bucket] >= pixel_size)
+        return bucket;
+    }
+    return (uint32_t)TextData::SizeBuckets.size() - 1;
+  }
+  
+  /// This function returns the layout of text from cache. Builds the layout if text is not in cache or glyphs are changed
+  /// - Parameters:
+  ///   - text: UTF-8 text
+  ///   - bucket: size bucket of glyphs
+  static const TextData::TextLayout& GetTextLayout(const std::string& text, uint32_t bucket) {
+    auto& layout = text_data_->layout_cache[std::hash<std::string>{}(text) * TextData::SizeBuckets.size() + bucket];
+    layout.last_used_frame = text_data_->frame;
+    
+    // Build if new text (or hash collision) or glyphs are changed. New entry has empty text, which is also the correct (empty) layout of
+    // empty text
+    if (layout.text != text or layout.bucket != bucket or layout.generation != text_data_->glyph_generation) {
+      layout.text = text;
+      layout.bucket = bucket;
+      layout.generation = text_data_->glyph_generation;
+      layout.quads.clear();
+      layout.pages = 0;
+      
+      float x = 0.0f;
+      for (size_t idx = 0; idx < text.size(); ) {
+        const uint32_t code_point = DecodeUTF8(text, idx);
+        
+        // Request the glyph if not rasterized in this bucket. Till then glyph of base bucket is used (if loaded)
+        uint32_t glyph_bucket = bucket;
+        auto it = text_data_->glyphs.find(GetGlyphKey(bucket, code_point));
+        if (it == text_data_->glyphs.end() or !it->second.loaded) {
+          if (it == text_data_->glyphs.end())
+            RequestGlyph(GetGlyphKey(bucket, code_point));
+          
+          glyph_bucket = TextData::BaseBucket;
+          it = text_data_->glyphs.find(GetGlyphKey(glyph_bucket, code_point));
+          if (it == text_data_->glyphs.end() or !it->second.loaded)
+            continue;
+        }
+        
+        // Glyph metrics are in pixels of its bucket, layout is in pixels of base bucket
+        const auto& ch = it->second;
+        const float glyph_scale = (float)TextData::GlyphPixelSize / TextData::SizeBuckets[glyph_bucket];
+        
+        // Empty glyphs (e.g. space) only advance the cursor
+        if (ch.size.x > 0 and ch.size.y > 0) {
+          float xpos = x + ch.bearing.x * glyph_scale;
+          float ypos = -(ch.size.y - ch.bearing.y) * glyph_scale;
+          layout.quads.push_back({ { xpos, ypos, xpos + ch.size.x * glyph_scale, ypos + ch.size.y * glyph_scale }, ch.uv_rect, (float)ch.page });
+          layout.pages |= 1u << ch.page;
+        }
+        
+        // now advance cursors for next glyph (note that advance is number of
+        // 1/64 pixels) bitshift by 6 to get value in pixels (2^6 = 64 (divide
+        // amount of 1/64th pixels by 64 to get amount of pixels))
+        x += (ch.advance >> 6) * glyph_scale;
+      }
+    }
+    return layout;
+  }
+  
+  void TextRenderer::RenderTextImpl(const std::string& text, const glm::vec3& position, const glm::vec2& scale, const glm::vec4& color) {
+    const auto& layout = GetTextLayout(text, GetSizeBucket(position, scale));
+    
+    // Mark the pages of text as used, so that they are not evicted
+    for (uint32_t page = 0; page < text_data_->atlas_pages.size(); page++) {
+      if (layout.pages & (1u << page))
+        text_data_->atlas_pages[page].last_used_frame = text_data_->frame;
+    }
+    
+    for (const auto& quad : layout.quads) {
+      if (text_data_->vertex_count >= TextData::MaxVertices) {
         Flush();
       }
       
-      std::shared_ptr<CharTexture> ch = text_data_->char_texture_map[*c];
-      
-      float xpos = position.x + ch->GetBearing().x * scale.x;
-      float ypos = position.y - (ch->GetSize().y - ch->GetBearing().y) * scale.y;
+      // Apply the position and scale of text to glyph quad
+      float x0 = position.x + quad.rect.x * scale.x, x1 = position.x + quad.rect.z * scale.x;
+      float y0 = position.y + quad.rect.y * scale.y, y1 = position.y + quad.rect.w * scale.y;
       float zpos = position.z;
       
-      float w = ch->GetSize().x * scale.x;
-      float h = ch->GetSize().y * scale.y;
-      
-      // update VBO for each character
-      glm::vec3 vertex_position[TextData::VertexForSingleChar] = {
-        { xpos,     ypos + h, zpos },
-        { xpos,     ypos    , zpos },
-        { xpos + w, ypos    , zpos },
-        
-        { xpos,     ypos + h, zpos },
-        { xpos + w, ypos    , zpos },
-        { xpos + w, ypos + h, zpos },
+      // update VBO for each character (top of glyph is at min v)
+      const glm::vec4& uv = quad.uv_rect;
+      const glm::vec3 vertex_position[TextData::VertexForSingleChar] = {
+        { x0, y1, zpos }, { x0, y0, zpos }, { x1, y0, zpos },
+        { x0, y1, zpos }, { x1, y0, zpos }, { x1, y1, zpos },
+      };
+      const glm::vec2 texture_coords[TextData::VertexForSingleChar] = {
+        { uv.x, uv.y }, { uv.x, uv.w }, { uv.z, uv.w },
+        { uv.x, uv.y }, { uv.z, uv.w }, { uv.z, uv.y },
       };
       
       // Each Vertex of Char
-      a = (float)text_data_->num_slots_used;
       for (size_t i = 0; i < TextData::VertexForSingleChar; i++) {
         text_data_->vertex_buffer_ptr->position      = vertex_position[i];
         text_data_->vertex_buffer_ptr->color         = color;
-        text_data_->vertex_buffer_ptr->texture_index = a;
-        text_data_->vertex_buffer_ptr->texture_coord = text_data_->base_texture_coords[i];
+        text_data_->vertex_buffer_ptr->texture_index = quad.page;
+        text_data_->vertex_buffer_ptr->texture_coord = texture_coords[i];
         text_data_->vertex_buffer_ptr->object_id     = -1;
         text_data_->vertex_buffer_ptr++;
       }
-      
-      // now advance cursors for next glyph (note that advance is number of
-      // 1/64 pixels) bitshift by 6 to get value in pixels (2^6 = 64 (divide
-      // amount of 1/64th pixels by 64 to get amount of pixels))
-      position.x += (ch->GetAdvance() >> 6) * scale.x;
-      
-      // Renderer Vertex count stat
-      RendererStatistics::Get().vertex_count += TextData::VertexForSingleChar;
-      
-      text_data_->char_textures[text_data_->num_slots_used] = ch;
-      text_data_->num_slots_used++;
+      text_data_->vertex_count += TextData::VertexForSingleChar;
     }
+    
+    // Renderer Vertex count stat
+    RendererStatistics::Get().vertex_count += (uint32_t)layout.quads.size() * TextData::VertexForSingleChar;
   }
   
 } // namespace ikan
@@ -12,47 +12,7 @@ namespace ikan {
   TextureComponent::TextureComponent(const std::shared_ptr<Texture>& comp, bool use) : use(use) {
     texture.push_back(comp);
   }
-  TextureComponent::TextureComponent(const TextureComponent& other) : use(other.use), tiling_factor(other.tiling_factor) {
-    if (other.texture.size() > 0){
-      for (auto& t : other.texture)
-        texture.push_back(Renderer::GetTexture(t->GetfilePath()));
-    }
-    IK_CORE_INFO(LogModule::Texture, "Copying TextureComponent");
-  }
-  
-  TextureComponent::TextureComponent(TextureComponent&& other) : use(other.use), tiling_factor(other.tiling_factor) {
-    if (other.texture.size() > 0){
-      for (auto& t : other.texture)
-        texture.push_back(Renderer::GetTexture(t->GetfilePath()));
-    }
-    IK_CORE_INFO(LogModule::Texture, "Moving TextureComponent");
-  }
-  
-  TextureComponent& TextureComponent::operator=(const TextureComponent& other) {
-    if (other.texture.size() > 0){
-      for (auto& t : other.texture)
-        texture.push_back(Renderer::GetTexture(t->GetfilePath()));
-    }
-
-    use = other.use;
-    tiling_factor = other.tiling_factor;
-    IK_CORE_INFO(LogModule::Texture, "Copying TextureComponent (=operator)");
-    return *this;
-  }
-  
-  TextureComponent& TextureComponent::operator=(TextureComponent&& other) {
-    if (other.texture.size() > 0){
-      for (auto& t : other.texture)
-        texture.push_back(Renderer::GetTexture(t->GetfilePath()));
-    }
-
-    use = other.use;
-    tiling_factor = other.tiling_factor;
-    IK_CORE_INFO(LogModule::Texture, "Moving TextureComponent (=operator)");
-    return *this;
-  }
-  
-  bool TextureComponent::LoadTextureIcon(std::shared_ptr<Texture>& texture, bool* is_animation, std::shared_ptr<Texture>& deleted_texture) {
+  bool TextureComponent::LoadTextureIcon(TextureHandle& texture, bool* is_animation, TextureHandle& deleted_texture) {
     bool texture_changed = false;
     static std::shared_ptr<Texture> no_texture = Renderer::GetTexture(DM::CoreAsset("textures/default/no_texture.png"));
     size_t tex_id = ((texture) ? texture->GetRendererID() : no_texture->GetRendererID());
@@ -84,7 +44,6 @@ namespace ikan {
     // Drop the texture here and load new texture
     PropertyGrid::DropConent([&](const std::string& path)
                              {
-      texture.reset();
       texture = Renderer::GetTexture(path);
       texture_changed = true;
     });
@@ -99,10 +58,10 @@ namespace ikan {
     return texture_changed;
   }
   
-  bool TextureComponent::LoadTextureIconWrapper(std::vector<std::shared_ptr<Texture>>& texture_vector) {
+  bool TextureComponent::LoadTextureIconWrapper(std::vector<TextureHandle>& texture_vector) {
     bool texture_changed = false;
     bool delete_texture = false;
-    std::shared_ptr<Texture> deleted_texture;
+    TextureHandle deleted_texture;
     
     float main_width = ImGui::GetWindowContentRegionWidth();
     ImVec2 init_pos = ImGui::GetCursorPos();
@@ -127,7 +86,7 @@ namespace ikan {
     ImGui::SameLine();
     
     bool new_texture_loaded = false;
-    std::shared_ptr<Texture> t;
+    TextureHandle t;
     texture_changed = LoadTextureIcon(t, nullptr, deleted_texture);
     new_texture_loaded = texture_changed;
     
@@ -169,7 +128,7 @@ namespace ikan {
     }
     
     if (texture.size() > 0)
-      sprite_images.emplace_back(SubTexture::CreateFromCoords(texture.at(0), {0.0f, 0.0f}));
+      sprite_images.emplace_back(SubTexture::CreateFromCoords(texture.at(0).GetShared(), {0.0f, 0.0f}));
   }
   
   SpriteComponent::~SpriteComponent() {
@@ -183,7 +142,9 @@ namespace ikan {
     use_sub_texture = other.use_sub_texture;
     speed = other.speed;
     anim_idx = other.anim_idx;
-    LoadSprite(other.texture, other.sprite_images, linear_edge);
+    sprite_sheet = other.sprite_sheet;
+    sprite_clip = other.sprite_clip;
+    LoadSprite(other.texture, other.sprite_images);
     
     IK_CORE_TRACE(LogModule::Texture, "Copying SpriteComponent");
   }
@@ -194,7 +155,9 @@ namespace ikan {
     use_sub_texture = other.use_sub_texture;
     speed = other.speed;
     anim_idx = other.anim_idx;
-    LoadSprite(other.texture, other.sprite_images, linear_edge);
+    sprite_sheet = other.sprite_sheet;
+    sprite_clip = other.sprite_clip;
+    LoadSprite(other.texture, other.sprite_images);
         
     IK_CORE_TRACE(LogModule::Texture, "Moving SpriteComponent");
   }
@@ -205,7 +168,9 @@ namespace ikan {
     speed = other.speed;
     linear_edge = other.linear_edge;
     anim_idx = other.anim_idx;
-    LoadSprite(other.texture, other.sprite_images, linear_edge);
+    sprite_sheet = other.sprite_sheet;
+    sprite_clip = other.sprite_clip;
+    LoadSprite(other.texture, other.sprite_images);
     
     IK_CORE_TRACE(LogModule::Texture, "Copying SpriteComponent (=operator)");
     return *this;
@@ -217,34 +182,30 @@ namespace ikan {
     linear_edge = other.linear_edge;
     speed = other.speed;
     anim_idx = other.anim_idx;
-    LoadSprite(other.texture, other.sprite_images, linear_edge);
+    sprite_sheet = other.sprite_sheet;
+    sprite_clip = other.sprite_clip;
+    LoadSprite(other.texture, other.sprite_images);
     
     IK_CORE_TRACE(LogModule::Texture, "Moving SpriteComponent (=operator)");
     return *this;
   }
   
-  void SpriteComponent::LoadSprite(const std::vector<std::shared_ptr<Texture>>& textures,
-                                   const std::vector<std::shared_ptr<SubTexture>>& sprites, bool linear_edge) {
-    ClearTextures();
-    ClearSprites();
-    
-    if (textures.size() > 0) {
-      for(auto& t : textures) {
-        texture.push_back(Renderer::GetTexture(t->GetfilePath(), linear_edge));
-      }
-      for (const auto& sprite : sprites) {
-        sprite_images.emplace_back(SubTexture::CreateFromCoords(sprite->GetSpriteImage(), sprite->GetCoords(),
-                                                                sprite->GetSpriteSize(), sprite->GetCellSize()));
-      }
-    }
+  void SpriteComponent::LoadSprite(const std::vector<TextureHandle>& textures,
+                                   const std::vector<std::shared_ptr<SubTexture>>& sprites) {
+    // Textures of other component are already loaded with same linear flag. Copy the handles only
+    texture = textures;
+    
+    // Sub textures are never modified (editor replaces them), so they are shared instead of created again from coords
+    if (textures.size() > 0)
+      sprite_images = sprites;
+    else
+      ClearSprites();
   }
   
   void SpriteComponent::ChangeLinearTexture() {
     for (auto& t : texture) {
       // Need to copy so not using reference as texture will deleted
       const std::string tex_path = t->GetfilePath();
-      
-      t.reset();
       t = Renderer::GetTexture(tex_path, linear_edge);
     }
     if (texture.size() > 0) {
@@ -253,7 +214,7 @@ namespace ikan {
         const glm::vec2 sprite_size = sprite->GetSpriteSize();
         const glm::vec2 cell_size = sprite->GetCellSize();
         
-        sprite = SubTexture::CreateFromCoords(texture.at(0), coords, sprite_size, cell_size);
+        sprite = SubTexture::CreateFromCoords(texture.at(0).GetShared(), coords, sprite_size, cell_size);
       }
     }
   }
@@ -294,15 +255,15 @@ namespace ikan {
     
     if (PropertyGrid::Float2("Coords", coords, nullptr, 0.1f, 0.0f, 0.0f, MAX_FLT, 100)) {
       sub_texture->GetSpriteImage().reset();
-      sub_texture = SubTexture::CreateFromCoords(texture.at(0), coords, sprite_size, cell_size);
+      sub_texture = SubTexture::CreateFromCoords(texture.at(0).GetShared(), coords, sprite_size, cell_size);
     }
     if (PropertyGrid::Float2("Sprite Size", sprite_size, nullptr, 1.0f, 1.0f, 0.0f, MAX_FLT, 100.0f)) {
       sub_texture->GetSpriteImage().reset();
-      sub_texture = SubTexture::CreateFromCoords(texture.at(0), coords, sprite_size, cell_size);
+      sub_texture = SubTexture::CreateFromCoords(texture.at(0).GetShared(), coords, sprite_size, cell_size);
     }
     if (PropertyGrid::Float2("Cell Size", cell_size, nullptr, 8.0f, 16.0f, 0.0f, MAX_FLT, 100.0f)) {
       sub_texture->GetSpriteImage().reset();
-      sub_texture = SubTexture::CreateFromCoords(texture.at(0), coords, sprite_size, cell_size);
+      sub_texture = SubTexture::CreateFromCoords(texture.at(0).GetShared(), coords, sprite_size, cell_size);
     }
     ImGui::Separator();
     
@@ -360,7 +321,7 @@ namespace ikan {
           coords.y = (((region_y + region_fixed_y)) / (cell_size.y * size_ratio)) - sprite_size.y;
           
           sub_texture->GetSpriteImage().reset();
-          sub_texture = SubTexture::CreateFromCoords(texture.at(0), coords, sprite_size, cell_size);
+          sub_texture = SubTexture::CreateFromCoords(texture.at(0).GetShared(), coords, sprite_size, cell_size);
         }
         
         ImGui::EndTooltip();
@@ -399,7 +360,7 @@ namespace ikan {
         }
       }
       if (add)
-        sprite_images.push_back(SubTexture::CreateFromCoords(texture.at(0), coords, sprite_size, cell_size));
+        sprite_images.push_back(SubTexture::CreateFromCoords(texture.at(0).GetShared(), coords, sprite_size, cell_size));
     }
     
     static bool delete_sprite = false;
@@ -444,23 +405,25 @@ namespace ikan {
     }
   }
 
-  void SpriteComponent::RenderGuiWork() {
+  bool SpriteComponent::RenderGuiWork() {
     ImGui::PushID("Texture Data");
+    bool changed = false;
 
     // Check box to togle use of texture
-    PropertyGrid::CheckBox("Use Texure", use);
+    changed |= PropertyGrid::CheckBox("Use Texure", use);
     PropertyGrid::HoveredMsg("Enable to Render the Sprite out the Texture");
     
     if (use and texture.size() > 0) {
       if (PropertyGrid::CheckBox("Linear Edge", linear_edge)) {
         ChangeLinearTexture();
+        changed = true;
       }
       PropertyGrid::HoveredMsg("Enable to Render the Sprite out the Texture");
       
-      PropertyGrid::CheckBox("Sprite", use_sub_texture);
+      changed |= PropertyGrid::CheckBox("Sprite", use_sub_texture);
       PropertyGrid::HoveredMsg("Enable to Render the Sprite out the Texture");
       
-      PropertyGrid::Float1("Tiling Factor", tiling_factor, nullptr, 1.0f, 1.0f, MIN_FLT, 1000.0f);
+      changed |= PropertyGrid::Float1("Tiling Factor", tiling_factor, nullptr, 1.0f, 1.0f, MIN_FLT, 1000.0f);
       PropertyGrid::HoveredMsg("Tiling Factor");
       
       // Texture ANimation Data
@@ -477,17 +440,23 @@ namespace ikan {
         ImGui::Separator();
         float speed_drag = (float)speed;
         float min_speed = (use_sub_texture) ? sprite_images.size() : texture.size();
-        if (PropertyGrid::Float1("Animation Speed", speed_drag, nullptr, 1.0f, min_speed, min_speed, MAX_FLT, ImGui::GetWindowContentRegionMax().x / 2))
+        if (PropertyGrid::Float1("Animation Speed", speed_drag, nullptr, 1.0f, min_speed, min_speed, MAX_FLT, ImGui::GetWindowContentRegionMax().x / 2)) {
           speed = (int32_t)speed_drag;
+          changed = true;
+        }
       }
     }
     ImGui::Separator();
     
+    // Texture icons and sub texture widgets do not report all the changes (e.g. deleted texture), so compare the handles and sprites
+    const std::vector<TextureHandle> prev_textures = texture;
+    const std::vector<std::shared_ptr<SubTexture>> prev_sprites = sprite_images;
+    
     // Render the Texture Vector Icon to load Texture from File
     if (LoadTextureIconWrapper(texture)) {
       use_sub_texture = false;
       ClearSprites();
-      sprite_images.emplace_back(SubTexture::CreateFromCoords(texture.at(0), {0, 0}));
+      sprite_images.emplace_back(SubTexture::CreateFromCoords(texture.at(0).GetShared(), {0, 0}));
     }
     
     // Render Sub texture Data
@@ -497,6 +466,9 @@ namespace ikan {
       SubtextureGui();
     }
     ImGui::PopID();
+    
+    changed |= (texture != prev_textures or sprite_images != prev_sprites);
+    return changed;
   }
   
 } // namespace ikan
@@ -40,6 +40,32 @@ x& x::operator=(x&& other) { \
   Copy(other); \
   return *this; \
 } \
+
+  // Change hook belongs to the entity. Copy/Move construction and move assignment are used by component pool to relocate the component
+  // of same entity, so hook is kept. Copy assignment only copies the data (and notifies own hook)
+#define COMP_COPY_MOVE_CONSTRUCTORS_WITH_HOOK(x) \
+x::x(const x& other) { \
+  Copy(other); \
+  change_hook = other.change_hook; \
+  COMP_COPY_LOG("Copying {0}", #x); \
+} \
+x::x(x&& other) { \
+  Copy(other); \
+  change_hook = other.change_hook; \
+  COMP_COPY_LOG("Moving {0}", #x); \
+} \
+x& x::operator=(const x& other) { \
+  COMP_COPY_LOG("Copying with = operator {0}", #x); \
+  Copy(other); \
+  return *this; \
+} \
+x& x::operator=(x&& other) { \
+  COMP_COPY_LOG("Moving with = operator {0}", #x); \
+  change_hook = ComponentChangeHook(); \
+  Copy(other); \
+  change_hook = other.change_hook; \
+  return *this; \
+} \
   
   // -------------------------------------------------------------------------
   // ID Component
@@ -70,7 +96,7 @@ x& x::operator=(x&& other) { \
     COMP_LOG("Creating Transform Component");
   }
   TransformComponent::~TransformComponent() { COMP_LOG("Destroying Transform Component"); }
-  COMP_COPY_MOVE_CONSTRUCTORS(TransformComponent);
+  COMP_COPY_MOVE_CONSTRUCTORS_WITH_HOOK(TransformComponent);
   
   void TransformComponent::Copy(const TransformComponent &other) {
     is_isometric = other.is_isometric;
@@ -78,6 +104,7 @@ x& x::operator=(x&& other) { \
     scale = other.Scale();
     rotation = other.Rotation();
     transform = Math::GetTransformMatrix(position, rotation, scale);
+    Modified();
     quaternion = glm::quat(rotation);
   }
   
@@ -96,11 +123,13 @@ x& x::operator=(x&& other) { \
       
       if (changed) {
         transform = Math::GetTransformMatrix(position, rotation, scale);
+        Modified();
       }
     }
     else {
       if (PropertyGrid::Float3("Position", position, nullptr, 0.1f, 0.0f, MIN_FLT, MAX_FLT, 80.0f)) {
         transform = Math::GetTransformMatrix(position, rotation, scale);
+        Modified();
       }
     }
 
@@ -108,10 +137,12 @@ x& x::operator=(x&& other) { \
     if (PropertyGrid::Float3("Rotation", rotation_in_degree, nullptr, 0.1f, 0.0f, MIN_FLT, MAX_FLT, 80.0f)) {
       rotation = glm::radians(rotation_in_degree);
       transform = Math::GetTransformMatrix(position, rotation, scale);
+      Modified();
     }
     
     if (PropertyGrid::Float3("Scale", scale, nullptr, 0.1f, 1.0f, MIN_FLT, MAX_FLT, 80.0f)) {
       transform = Math::GetTransformMatrix(position, rotation, scale);
+      Modified();
     }
     ImGui::Separator();
   }
@@ -155,18 +186,29 @@ x& x::operator=(x&& other) { \
   // -------------------------------------------------------------------------
   QuadComponent::QuadComponent() { COMP_LOG("Creating Quad Component"); }
   QuadComponent::~QuadComponent() { COMP_LOG("Destroying Quad Component"); }
-  COMP_COPY_MOVE_CONSTRUCTORS(QuadComponent);
+  COMP_COPY_MOVE_CONSTRUCTORS_WITH_HOOK(QuadComponent);
   
   void QuadComponent::Copy(const QuadComponent &other) {
     color = other.color;
     sprite = other.sprite;
+    is_static = other.is_static;
+    MarkModified();
   }
 
   void QuadComponent::RenderGui() {
-    sprite.RenderGui(color, [this]() {
-      ImGui::ColorEdit4("Color ", glm::value_ptr(color), ImGuiColorEditFlags_NoInputs | ImGuiColorEditFlags_NoLabel);
+    bool changed = PropertyGrid::CheckBox("Static", is_static);
+    PropertyGrid::HoveredMsg("Static quads are rendered from cached batch (not rebuilt each frame)");
+    ImGui::Separator();
+
+    changed |= sprite.RenderGui(color, [this]() {
+      bool color_changed = ImGui::ColorEdit4("Color ", glm::value_ptr(color), ImGuiColorEditFlags_NoInputs | ImGuiColorEditFlags_NoLabel);
       PropertyGrid::HoveredMsg("Texture filter color");
+      return color_changed;
     });
+    
+    // Rebuild the static quad only when a widget changes it
+    if (changed)
+      MarkModified();
   }
   
   // -------------------------------------------------------------------------
@@ -183,11 +225,7 @@ x& x::operator=(x&& other) { \
     if (other.texture_comp.texture.size() > 0) {
       texture_comp.use = other.texture_comp.use;
       texture_comp.tiling_factor = other.texture_comp.tiling_factor;
-      texture_comp.ClearTextures();
-      
-      for(auto& tex : other.texture_comp.texture) {
-        texture_comp.texture.push_back(Renderer::GetTexture(tex->GetfilePath()));
-      }
+      texture_comp.texture = other.texture_comp.texture;
     }
   }
 
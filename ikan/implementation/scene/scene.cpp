@@ -9,6 +9,9 @@
 #include "scene/components.hpp"
 #include "scene/core_entity.hpp"
 #include "renderer/utils/batch_2d_renderer.hpp"
+#include "renderer/utils/renderer_stats.hpp"
+#include "renderer/utils/render_queue_2d.hpp"
+#include "renderer/utils/static_batch_2d.hpp"
 #include "renderer/utils/text_renderer.hpp"
 
 #include <box2d/b2_polygon_shape.h>
@@ -17,79 +20,199 @@
 
 namespace ikan {
   
+  static constexpr glm::vec2 texture_coords_[] = {
+    { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }
+  };
+  
+  /// This function returns the world space bounds (min x, min y, max x, max y) of orthographic camera view
+  /// - Parameters:
+  ///   - camera: scene camera (should be orthographic)
+  ///   - transform: transform matrix of camera
+  static glm::vec4 GetOrthographicViewBounds(const SceneCamera& camera, const glm::mat4& transform) {
+    const float half_height = camera.GetZoom() * 0.5f;
+    const float half_width = half_height * camera.GetAspectRatio();
+    
+    // Rotated view rectangle is enclosed in an axis aligned box
+    const glm::vec2 extent = {
+      std::abs(transform[0][0]) * half_width + std::abs(transform[1][0]) * half_height,
+      std::abs(transform[0][1]) * half_width + std::abs(transform[1][1]) * half_height
+    };
+    return { transform[3][0] - extent.x, transform[3][1] - extent.y, transform[3][0] + extent.x, transform[3][1] + extent.y };
+  }
+  
+  /// This function checks if the unit sprite (quad or circle) transformed by matrix is outside the view bounds. Sprite bounds are the axis
+  /// aligned box of transformed unit quad, so result is conservative (never culls a visible sprite)
+  /// - Parameters:
+  ///   - transform: transform matrix of sprite
+  ///   - view_bounds: world space bounds of camera view (min x, min y, max x, max y)
+  static bool IsSpriteCulled(const glm::mat4& transform, const glm::vec4& view_bounds) {
+    const float extent_x = 0.5f * (std::abs(transform[0][0]) + std::abs(transform[1][0]));
+    const float extent_y = 0.5f * (std::abs(transform[0][1]) + std::abs(transform[1][1]));
+    return transform[3][0] + extent_x < view_bounds.x or transform[3][0] - extent_x > view_bounds.z or
+           transform[3][1] + extent_y < view_bounds.y or transform[3][1] - extent_y > view_bounds.w;
+  }
+  
+  /// This function keeps the library textures of sprite resident, even if sprite is culled or texture is not the current animation frame,
+  /// so that sprite does not render the placeholder of evicted texture when it comes back in view
+  /// - Parameter textures: textures of sprite
+  static void MarkTexturesInUse(const std::vector<TextureHandle>& textures) {
+    for (const auto& texture : textures)
+      texture.MarkInUse();
+  }
+  
+  /// Tag of quads rendered by streaming batch each frame (not in static batch). Dynamic quads are iterated without visiting static quads
+  struct DynamicQuadTag {};
+  
+  /// This function checks if quad can be rendered from static batch. Animated quads are always dynamic. Translucent quads are dynamic
+  /// too, as static chunks are drawn before the sorted queue and only depth test orders them (texels are alpha tested in shader)
+  /// - Parameter quad_comp: quad data
+  static bool IsStaticQuad(const QuadComponent& quad_comp) {
+    const auto& sprite = quad_comp.sprite;
+    return quad_comp.is_static and quad_comp.color.a >= 1.0f and !sprite.sprite_sheet and sprite.texture.size() <= 1 and
+           sprite.sprite_images.size() <= 1;
+  }
+  
   template<typename... Component>
   static void ReserveRegistry(ComponentGroup<Component...>, entt::registry& registry, int32_t capacity) {
     registry.reserve<Component...>(capacity);
   }
   
   template<typename... Component>
-  static void CopyComponent(entt::registry& dst,
-                            entt::registry& src,
-                            const std::unordered_map<UUID, entt::entity>& enttMap) {
+  static void CopyComponentPools(entt::registry& dst,
+                                 entt::registry& src,
+                                 const std::vector<entt::entity>& entity_remap) {
     ([&]()
      {
       auto view = src.view<Component>();
-      for (auto src_entity : view) {
-        entt::entity dst_entity = enttMap.at(src.get<IDComponent>(src_entity).id);
-        
-        auto& srcComponent = src.get<Component>(src_entity);
-        dst.emplace_or_replace<Component>(dst_entity, srcComponent);
-      }
+      if (view.empty())
+        return;
+      
+      // Entities of pool in new scene, in the order of components in pool
+      const entt::entity* src_entities = view.data();
+      std::vector<entt::entity> dst_entities(view.size());
+      for (size_t i = 0; i < view.size(); i++)
+        dst_entities[i] = entity_remap[entt::registry::entity(src_entities[i])];
+      
+      // Append whole pool at once (memmove for trivially copyable components)
+      dst.insert<Component>(dst_entities.begin(), dst_entities.end(), view.raw(), view.raw() + view.size());
     }(), ...);
   }
   
   template<typename... Component>
-  static void CopyComponent(ComponentGroup<Component...>,
-                            entt::registry& dst,
-                            entt::registry& src,
-                            const std::unordered_map<UUID, entt::entity>& entt_map) {
-    CopyComponent<Component...>(dst, src, entt_map);
+  static void CopyComponentPools(ComponentGroup<Component...>,
+                                 entt::registry& dst,
+                                 entt::registry& src,
+                                 const std::vector<entt::entity>& entity_remap) {
+    CopyComponentPools<Component...>(dst, src, entity_remap);
   }
   
   template<typename... Component>
-  static void CopyComponentIfExists(Entity dst, Entity src) {
+  static void CopyComponentToEntities(entt::registry& registry, const std::vector<entt::entity>& entities, entt::entity src) {
     ([&]()
      {
-      if (src.HasComponent<Component>())
-        dst.AddOrReplaceComponent<Component>(src.GetComponent<Component>());
+      if (!registry.has<Component>(src))
+        return;
+      
+      // Take copy first as pool storage may grow while inserting
+      const Component component = registry.get<Component>(src);
+      registry.insert<Component>(entities.begin(), entities.end(), component);
     }(), ...);
   }
   
   template<typename... Component>
-  static void CopyComponentIfExists(ComponentGroup<Component...>, Entity dst, Entity src) {
-    CopyComponentIfExists<Component...>(dst, src);
+  static void CopyComponentToEntities(ComponentGroup<Component...>,
+                                      entt::registry& registry,
+                                      const std::vector<entt::entity>& entities,
+                                      entt::entity src) {
+    CopyComponentToEntities<Component...>(registry, entities, src);
+  }
+  
+  template<typename... Component>
+  static void CopyComponentsOfEntities(entt::registry& registry, const std::vector<entt::entity>& entities,
+                                       std::span<const entt::entity> src_entities) {
+    ([&]()
+     {
+      // Take copies first as pool storage may grow while inserting
+      std::vector<entt::entity> dst_entities;
+      std::vector<Component> components;
+      for (size_t i = 0; i < src_entities.size(); i++) {
+        if (!registry.has<Component>(src_entities[i]))
+          continue;
+        dst_entities.push_back(entities[i]);
+        components.push_back(registry.get<Component>(src_entities[i]));
+      }
+      if (dst_entities.empty())
+        return;
+      
+      registry.insert<Component>(dst_entities.begin(), dst_entities.end(), components.begin(), components.end());
+    }(), ...);
   }
   
-  template<typename Component>
-  static void CopySingleComponentIfExists(Entity& dst, Entity& src) {
-    if (src.HasComponent<Component>())
-      dst.AddOrReplaceComponent<Component>(src.GetComponent<Component>());
+  template<typename... Component>
+  static void CopyComponentsOfEntities(ComponentGroup<Component...>,
+                                       entt::registry& registry,
+                                       const std::vector<entt::entity>& entities,
+                                       std::span<const entt::entity> src_entities) {
+    CopyComponentsOfEntities<Component...>(registry, entities, src_entities);
   }
 
   std::shared_ptr<Scene> Scene::Copy(std::shared_ptr<Scene> other) {
-    std::shared_ptr<Scene> new_scene = std::make_shared<Scene>(other->GetFilePath());
+    auto& src_scene_registry = other->registry_;
+    auto id_view = src_scene_registry.view<IDComponent>();
+    const uint32_t num_entities = (uint32_t)id_view.size();
+
+    // New scene reserves all the component pools and UUID index for all entities up front
+    std::shared_ptr<Scene> new_scene = std::make_shared<Scene>(other->GetFilePath(),
+                                                               std::max(other->curr_registry_capacity, num_entities));
     new_scene->setting_= other->setting_;
     new_scene->type_ = other->type_;
-
-    auto& src_scene_registry = other->registry_;
+    new_scene->texture_atlas_ = other->texture_atlas_;
     auto& dst_scene_registry = new_scene->registry_;
-    std::unordered_map<UUID, entt::entity> entt_map;
 
-    // Create entities in new scene
-    auto id_view = src_scene_registry.view<IDComponent>();
-    for (auto e : id_view) {
-      UUID uuid = src_scene_registry.get<IDComponent>(e).id;
-      const auto& name = src_scene_registry.get<TagComponent>(e).tag;
-      Entity new_entity = new_scene->CreateEntity(name, uuid);
-      entt_map[uuid] = (entt::entity)new_entity;
+    // Create all entities in one batch, and map the source entity number to new entity
+    std::vector<entt::entity> dst_entities(num_entities);
+    dst_scene_registry.create(dst_entities.begin(), dst_entities.end());
+
+    std::vector<entt::entity> entity_remap(src_scene_registry.size(), entt::null);
+    const entt::entity* src_entities = id_view.data();
+    const IDComponent* src_ids = id_view.raw();
+    for (uint32_t i = 0; i < num_entities; i++) {
+      entity_remap[entt::registry::entity(src_entities[i])] = dst_entities[i];
+      new_scene->RegisterEntity(dst_entities[i], src_ids[i].id);
     }
     
-    // Copy components (except IDComponent and TagComponent)
-    CopyComponent(AllCopyComponents{}, dst_scene_registry, src_scene_registry, entt_map);
+    // Copy each component pool in bulk (including IDComponent and TagComponent)
+    CopyComponentPools(AllComponents{}, dst_scene_registry, src_scene_registry, entity_remap);
 
+    IK_CORE_TRACE(LogModule::Scene, "Copied Scene '{0}' with {1} entities", new_scene->name_, num_entities);
     return new_scene;
   }
 
+  /// This function remaps the texture coordinates of quad to its region in texture atlas. Returns false if there is no atlas or texture is
+  /// not in atlas
+  /// - Parameters:
+  ///   - texture_atlas: texture atlas (can be nullptr)
+  ///   - texture: texture of quad. Replaced by atlas page
+  ///   - coords: texture coordinates of 4 vertices
+  ///   - atlas_coords: texture coordinates in atlas page (output)
+  static bool RemapToTextureAtlas(const TextureAtlas* texture_atlas, TextureHandle& texture, const glm::vec2* coords,
+                                  glm::vec2* atlas_coords) {
+    if (!texture_atlas)
+      return false;
+    
+    glm::vec4 uv_rect = { coords[0], coords[2] };
+    TextureHandle page;
+    if (!texture_atlas->Remap(texture, uv_rect, page))
+      return false;
+    
+    texture = page;
+    atlas_coords[0] = { uv_rect.x, uv_rect.y };
+    atlas_coords[1] = { uv_rect.z, uv_rect.y };
+    atlas_coords[2] = { uv_rect.z, uv_rect.w };
+    atlas_coords[3] = { uv_rect.x, uv_rect.w };
+    return true;
+  }
+  
   Scene::Scene(const std::string& file_path, uint32_t max_entity_capacity)
   : file_path_(file_path), name_(StringUtils::GetNameFromFilePath(file_path)), curr_registry_capacity(max_entity_capacity) {
     IK_CORE_TRACE(LogModule::Scene, "Creating Scene ...");
@@ -98,6 +221,17 @@ namespace ikan {
     IK_CORE_TRACE(LogModule::Scene, "  Registry Capacity  {0}", curr_registry_capacity);
 
     ReserveRegistry(AllComponents{}, registry_, curr_registry_capacity);
+    uuid_map_.Reserve(curr_registry_capacity);
+    
+    static_batch_2d_ = std::make_shared<StaticBatch2D>();
+    
+    // Track the modified quads, so that static batch is updated only for them
+    registry_.on_construct<QuadComponent>().connect<&Scene::OnQuadChanged>(*this);
+    registry_.on_update<QuadComponent>().connect<&Scene::OnQuadChanged>(*this);
+    registry_.on_destroy<QuadComponent>().connect<&Scene::OnQuadRemoved>(*this);
+    registry_.on_construct<TransformComponent>().connect<&Scene::OnTransformChanged>(*this);
+    registry_.on_update<TransformComponent>().connect<&Scene::OnTransformChanged>(*this);
+    registry_.on_destroy<TransformComponent>().connect<&Scene::OnQuadRemoved>(*this);
 
     // Set the Scene state and register their corresponding Functions
     if (state_ == State::Edit)
@@ -130,33 +264,113 @@ namespace ikan {
     IK_CORE_TRACE(LogModule::Scene, "  Number of entities Added in Scene  {0}", num_entities_);
     IK_CORE_TRACE(LogModule::Scene, "  Max ID given to entity             {0}", max_entity_id_);
 
-    return entity_id_map_.at((entt::entity)entity);
+    return entity_table_.At((entt::entity)entity);
   }
 
   Entity Scene::CreateUniqueEntity(UUID uuid) {
-    if (registry_.size() >= curr_registry_capacity) {
-      IK_ASSERT(false, "Temp Assert to check performance")
-      curr_registry_capacity *= 2;
-      ReserveRegistry(AllComponents{}, registry_, curr_registry_capacity);
-    }
+    ReserveEntities(1);
     
     Entity entity {registry_.create(), this};
 
-    // Assert if this entity id is already present in scene entity map
-    IK_ASSERT((entity_id_map_.find(entity) == entity_id_map_.end()), "Entity Already Added");
-
     // Add the Mendatory components
     entity.AddComponent<IDComponent>(uuid);
 
-    // Store the entity in the entity uuid map. We Copy the Entity
-    entity_id_map_[entity] = entity;
+    RegisterEntity(entity, uuid);
+    return entity;
+  }
+  
+  std::vector<entt::entity> Scene::CreateUniqueEntities(uint32_t count) {
+    ReserveEntities(count);
+    
+    std::vector<entt::entity> entities(count);
+    registry_.create(entities.begin(), entities.end());
+    
+    // Add the Mendatory components
+    for (auto entity : entities) {
+      UUID uuid;
+      registry_.emplace<IDComponent>(entity, uuid);
+      RegisterEntity(entity, uuid);
+    }
+    return entities;
+  }
+  
+  void Scene::ReserveEntities(uint32_t num_new_entities) {
+    const uint32_t required_capacity = num_entities_ + num_new_entities;
+    if (required_capacity <= curr_registry_capacity)
+      return;
+    
+    // Grow geometrically, so that entities created one by one do not reserve the pools each time
+    curr_registry_capacity = std::max(curr_registry_capacity * 2, required_capacity);
+    ReserveRegistry(AllComponents{}, registry_, curr_registry_capacity);
+    uuid_map_.Reserve(curr_registry_capacity);
+    
+    IK_CORE_INFO(LogModule::Scene, "Registry Capacity of Scene '{0}' increased to {1}", name_, curr_registry_capacity);
+  }
+  
+  void Scene::RegisterEntity(entt::entity entity, UUID uuid) {
+    // Store the entity in the entity table (asserts if already present). We Copy the Entity
+    entity_table_.Insert(Entity(entity, this));
+    
+    // Index the entity by its UUID
+    IK_ASSERT(!uuid_map_.Contains(uuid), "Entity with same UUID Already Added");
+    uuid_map_.Insert(uuid, entity);
 
     // Updating the Max entity ID
-    max_entity_id_ = (int32_t)((uint32_t)entity);
+    max_entity_id_ = std::max(max_entity_id_, (int32_t)entity);
 
     ++num_entities_;
+  }
+  
+  std::vector<Entity*> Scene::CreateEntities(uint32_t count, const std::string& name) {
+    std::vector<entt::entity> entities = CreateUniqueEntities(count);
+    registry_.insert<TagComponent>(entities.begin(), entities.end(), TagComponent(name));
+    registry_.insert<TransformComponent>(entities.begin(), entities.end());
 
-    return entity;
+    IK_CORE_TRACE(LogModule::Scene, "Stored {0} Entities '{1}' in Scene", count, name);
+    IK_CORE_TRACE(LogModule::Scene, "  Number of entities Added in Scene  {0}", num_entities_);
+    IK_CORE_TRACE(LogModule::Scene, "  Max ID given to entity             {0}", max_entity_id_);
+
+    std::vector<Entity*> result(count);
+    for (uint32_t i = 0; i < count; i++)
+      result[i] = entity_table_.Find(entities[i]);
+    return result;
+  }
+  
+  std::vector<Entity*> Scene::CreateEntities(uint32_t count, const Entity& archetype) {
+    const entt::entity archetype_handle = archetype;
+    IK_ASSERT(entity_table_.Contains(archetype_handle), "Archetype is not an entity of this scene");
+
+    std::vector<entt::entity> entities = CreateUniqueEntities(count);
+    CopyComponentToEntities<TagComponent>(registry_, entities, archetype_handle);
+    CopyComponentToEntities(AllCopyComponents{}, registry_, entities, archetype_handle);
+
+    IK_CORE_TRACE(LogModule::Scene, "Stored {0} Copies of Entity {1} in Scene", count, (uint32_t)archetype_handle);
+    IK_CORE_TRACE(LogModule::Scene, "  Number of entities Added in Scene  {0}", num_entities_);
+    IK_CORE_TRACE(LogModule::Scene, "  Max ID given to entity             {0}", max_entity_id_);
+
+    std::vector<Entity*> result(count);
+    for (uint32_t i = 0; i < count; i++)
+      result[i] = entity_table_.Find(entities[i]);
+    return result;
+  }
+  
+  std::vector<Entity*> Scene::DuplicateEntities(std::span<const entt::entity> entities) {
+    for ([[maybe_unused]] auto entity : entities)
+      IK_ASSERT(entity_table_.Contains(entity), "Entity to be duplicated is not an entity of this scene");
+    
+    const uint32_t count = (uint32_t)entities.size();
+    std::vector<entt::entity> new_entities = CreateUniqueEntities(count);
+    CopyComponentsOfEntities<TagComponent>(registry_, new_entities, entities);
+    CopyComponentsOfEntities(AllCopyComponents{}, registry_, new_entities, entities);
+    
+    IK_CORE_TRACE(LogModule::Scene, "Duplicated {0} Entities in Scene", count);
+    IK_CORE_TRACE(LogModule::Scene, "  Number of entities Added in Scene  {0}", num_entities_);
+    IK_CORE_TRACE(LogModule::Scene, "  Max ID given to entity             {0}", max_entity_id_);
+    
+    std::vector<Entity*> result(count);
+    for (uint32_t i = 0; i < count; i++)
+      result[i] = entity_table_.Find(new_entities[i]);
+    return result;
   }
   
   void Scene::DestroyEntity(Entity entity) {
@@ -164,66 +378,98 @@ namespace ikan {
     IK_CORE_WARN(LogModule::Scene, "  Name    {0}", entity.GetComponent<TagComponent>().tag.c_str());
     IK_CORE_WARN(LogModule::Scene, "  Handle  {0}", (uint32_t)entity);
     IK_CORE_WARN(LogModule::Scene, "  ID      {0}", entity.GetComponent<IDComponent>().id);
-    IK_CORE_WARN(LogModule::Scene, "  Number of entities left in the Scene  {0}", --num_entities_);
    
-    // Delete physics data
-    if (physics_2d_world_ and entity.HasComponent<RigidBodyComponent>()) {
-      auto& rb = entity.GetComponent<RigidBodyComponent>();
-      ResetFixture((b2Body*)rb.runtime_body);
+    const entt::entity handle = entity;
+    DestroyEntities({ &handle, 1 });
+  }
+  
+  void Scene::DestroyEntities(std::span<const entt::entity> entities) {
+    // Scripts and contact callbacks may still use the entity (or its physics body) in this frame
+    if (state_ == State::Play) {
+      destroy_queue_.insert(destroy_queue_.end(), entities.begin(), entities.end());
+      return;
+    }
+    DestroyEntitiesImmediate(entities);
+  }
+  
+  void Scene::FlushDestroyedEntities() {
+    if (destroy_queue_.empty())
+      return;
+    
+    // Swap the queue, as destroying scripts may queue more entities
+    std::vector<entt::entity> entities;
+    entities.swap(destroy_queue_);
+    DestroyEntitiesImmediate(entities);
+    
+    // Keep the storage of queue for next frames
+    entities.clear();
+    if (destroy_queue_.empty())
+      destroy_queue_.swap(entities);
+  }
+  
+  void Scene::DestroyEntitiesImmediate(std::span<const entt::entity> entities) {
+    // Remove the entities from the table and UUID index. Skips handles already destroyed (or repeated in span)
+    std::vector<entt::entity> handles;
+    handles.reserve(entities.size());
+    for (auto entity : entities) {
+      if (!entity_table_.Contains(entity))
+        continue;
       
-      physics_2d_world_->DestroyBody((b2Body*)rb.runtime_body);
-      rb.runtime_body = nullptr;
+      uuid_map_.Erase(registry_.get<IDComponent>(entity).id);
+      entity_table_.Erase(entity);
+      handles.push_back(entity);
     }
-
+    if (handles.empty())
+      return;
+    
     // Destory the Scripts data
-    if (entity.HasComponent<NativeScriptComponent>()) {
-      auto& nsc = entity.GetComponent<NativeScriptComponent>();
-      nsc.script->Destroy();
+    for (auto entity : handles) {
+      if (auto* nsc = registry_.try_get<NativeScriptComponent>(entity); nsc and nsc->script)
+        nsc->script->Destroy();
     }
     
-    if (type_ == _2D) {
-      if (entity.HasComponent<CircleColliiderComponent>()) {
-        auto& cc = entity.GetComponent<CircleColliiderComponent>();
-        delete cc.runtime_fixture;
-        cc.runtime_fixture = nullptr;
-      }
-      
-      if (entity.HasComponent<Box2DColliderComponent>()) {
-        auto& bc = entity.GetComponent<Box2DColliderComponent>();
-        delete bc.runtime_fixture;
-        bc.runtime_fixture = nullptr;
+    // Delete physics data. Destroying the body also destroys all its fixtures, contacts and joints
+    if (physics_2d_world_) {
+      IK_ASSERT(!physics_2d_world_->IsLocked(), "Can not destroy physics bodies while physics world is stepping");
+      for (auto entity : handles) {
+        if (auto* rb = registry_.try_get<RigidBodyComponent>(entity); rb and rb->runtime_body) {
+          physics_2d_world_->DestroyBody((b2Body*)rb->runtime_body);
+          rb->runtime_body = nullptr;
+        }
       }
-      
-      if (entity.HasComponent<PillBoxColliderComponent>()) {
-        auto& pbc = entity.GetComponent<PillBoxColliderComponent>();
-        delete pbc.bcc.runtime_fixture;
-        pbc.bcc.runtime_fixture = nullptr;
-        delete pbc.top_ccc.runtime_fixture;
-        pbc.top_ccc.runtime_fixture = nullptr;
-        delete pbc.bottom_ccc.runtime_fixture;
-        pbc.bottom_ccc.runtime_fixture = nullptr;
+    }
+    
+    if (type_ == _2D) {
+      for (auto entity : handles) {
+        if (auto* cc = registry_.try_get<CircleColliiderComponent>(entity)) {
+          delete cc->runtime_fixture;
+          cc->runtime_fixture = nullptr;
+        }
+        
+        if (auto* bc = registry_.try_get<Box2DColliderComponent>(entity)) {
+          delete bc->runtime_fixture;
+          bc->runtime_fixture = nullptr;
+        }
+        
+        if (auto* pbc = registry_.try_get<PillBoxColliderComponent>(entity)) {
+          delete pbc->bcc.runtime_fixture;
+          pbc->bcc.runtime_fixture = nullptr;
+          delete pbc->top_ccc.runtime_fixture;
+          pbc->top_ccc.runtime_fixture = nullptr;
+          delete pbc->bottom_ccc.runtime_fixture;
+          pbc->bottom_ccc.runtime_fixture = nullptr;
+        }
       }
     }
     
-    // Delete the eneity from the map
-    entity_id_map_.erase(entity);
-    registry_.destroy(entity);
+    registry_.destroy(handles.begin(), handles.end());
+    num_entities_ -= (uint32_t)handles.size();
+    
+    IK_CORE_WARN(LogModule::Scene, "Removed {0} Entities from Scene. Number of entities left in the Scene {1}", handles.size(), num_entities_);
   }
   
   Entity& Scene::DuplicateEntity(Entity entity) {
-    Entity new_entity = CreateUniqueEntity(UUID());
-    CopySingleComponentIfExists<TagComponent>(new_entity, entity);
-    CopyComponentIfExists(AllCopyComponents{}, new_entity, entity);
-    
-    // Debug Logs
-    IK_CORE_TRACE(LogModule::Scene, "Stored Entity in Scene");
-    IK_CORE_TRACE(LogModule::Scene, "  Name    {0}", new_entity.GetComponent<TagComponent>().tag.c_str());
-    IK_CORE_TRACE(LogModule::Scene, "  Handle  {0}", (uint32_t)new_entity);
-    IK_CORE_TRACE(LogModule::Scene, "  ID      {0}", new_entity.GetComponent<IDComponent>().id);
-    IK_CORE_TRACE(LogModule::Scene, "  Number of entities Added in Scene {0}", num_entities_);
-    IK_CORE_TRACE(LogModule::Scene, "  Max ID given to entity            {0}", max_entity_id_);
-    
-    return entity_id_map_.at((entt::entity)entity);
+    return *CreateEntities(1, entity).front();
   }
   
   void Scene::Update(Timestep ts) {
@@ -235,6 +481,7 @@ namespace ikan {
     else {
       InstantiateScript(ts);
       UpdatePhysics(ts);
+      FlushDestroyedEntities();
       UpdateRuntime(ts);
     }
   }
@@ -258,7 +505,14 @@ namespace ikan {
   void Scene::UpdateRuntime(Timestep ts) {
     if (primary_camera_data_.scene_camera) {
       if (type_ == _2D) {
-        Render2DEntities(primary_camera_data_.scene_camera->GetProjection() * glm::inverse(primary_camera_data_.transform_matrix));
+        const auto& camera = *primary_camera_data_.scene_camera;
+        if (camera.GetProjectionType() == SceneCamera::ProjectionType::Orthographic) {
+          glm::vec4 view_bounds = GetOrthographicViewBounds(camera, primary_camera_data_.transform_matrix);
+          Render2DEntities(camera.GetProjection() * glm::inverse(primary_camera_data_.transform_matrix), &view_bounds);
+        }
+        else {
+          Render2DEntities(camera.GetProjection() * glm::inverse(primary_camera_data_.transform_matrix));
+        }
       }
       else if (type_ == _3D) {
       }
@@ -277,7 +531,7 @@ namespace ikan {
       // Get Transform
       auto view = registry_.view<RigidBodyComponent>();
       for (auto e : view) {
-        Entity& entity = entity_id_map_.at(e);
+        Entity& entity = entity_table_.At(e);
         
         auto& rb2d = entity.GetComponent<RigidBodyComponent>();
         if (rb2d.type == RigidBodyComponent::RbBodyType::Dynamic or rb2d.type == RigidBodyComponent::RbBodyType::Kinametic) {
@@ -294,64 +548,107 @@ namespace ikan {
     } // if (type_ == _2D)
   }
   
-  void Scene::Render2DEntities(const glm::mat4& cam_view_proj_mat) {
+  void Scene::Render2DEntities(const glm::mat4& cam_view_proj_mat, const glm::vec4* view_bounds) {
     Batch2DRenderer::BeginBatch(cam_view_proj_mat);
+    RenderQueue2D::Begin(texture_atlas_.get());
+    UpdateStaticQuads();
+    
+    auto& stats_2d = RendererStatistics::Get().stats_2d_;
     
     auto circle_view = registry_.view<TransformComponent, CircleComponent>();
     // For all circle entity
     for (const auto& circle_entity : circle_view) {
       const auto& [transform_component, circle_component] = circle_view.get<TransformComponent, CircleComponent>(circle_entity);
+      MarkTexturesInUse(circle_component.texture_comp.texture);
+      if (view_bounds and IsSpriteCulled(transform_component.Transform(), *view_bounds)) {
+        stats_2d.sprites_culled++;
+        continue;
+      }
+      stats_2d.sprites_submitted++;
+      
       if (circle_component.texture_comp.use and circle_component.texture_comp.texture.size() > 0) {
-        Batch2DRenderer::DrawCircle(transform_component.Transform(), circle_component.texture_comp.texture.at(0), circle_component.color,
+        RenderQueue2D::SubmitCircle(transform_component.Transform(), circle_component.texture_comp.texture.at(0), circle_component.color,
                                     circle_component.texture_comp.tiling_factor, circle_component.thickness, circle_component.fade, (uint32_t)circle_entity);
         
       } else {
-        Batch2DRenderer::DrawCircle(transform_component.Transform(), circle_component.color, circle_component.thickness, circle_component.fade,
-                                    (uint32_t)circle_entity);
+        RenderQueue2D::SubmitCircle(transform_component.Transform(), nullptr, circle_component.color, 1.0f /* tiling factor */,
+                                    circle_component.thickness, circle_component.fade, (uint32_t)circle_entity);
       }
     } // for (const auto& entity : circle_view)
 
-    // Render All Quad Entities
-    auto quad_view = registry_.view<TransformComponent, QuadComponent>();
+    // Render All Dynamic Quad Entities
+    auto quad_view = registry_.view<DynamicQuadTag, TransformComponent, QuadComponent>();
     for (const auto& quad_entity : quad_view) {
       const auto& [transform_comp, quad_comp] = quad_view.get<TransformComponent, QuadComponent>(quad_entity);
       auto& sprite = quad_comp.sprite;
       
-      if (sprite.use and sprite.texture.size() > 0) {
+      // Number of animation frames of sprite (sprite sheet clip, sprite images or textures)
+      size_t num_anim_frames = 0;
+      if (sprite.use and sprite.use_sub_texture and sprite.sprite_sheet)
+        num_anim_frames = sprite.sprite_sheet->GetClip(sprite.sprite_clip).num_frames;
+      else if (sprite.use and sprite.texture.size() > 0)
+        num_anim_frames = sprite.use_sub_texture ? sprite.sprite_images.size() : sprite.texture.size();
+      
+      // Advance the animation before culling, so that animation of off-screen sprite keeps running
+      int32_t anim_frame = 0;
+      if (num_anim_frames > 1) {
+        sprite.ResetAnimIndx();
+        anim_frame = sprite.anim_idx / sprite.speed;
+        sprite.anim_idx++;
+      }
+      
+      MarkTexturesInUse(sprite.texture);
+      if (view_bounds and IsSpriteCulled(transform_comp.Transform(), *view_bounds)) {
+        stats_2d.sprites_culled++;
+        continue;
+      }
+      stats_2d.sprites_submitted++;
+      
+      // Sprite sheet clip. Frame is picked from contiguous UV rects of sheet
+      if (sprite.use and sprite.use_sub_texture and sprite.sprite_sheet) {
+        const SpriteSheet::Clip& clip = sprite.sprite_sheet->GetClip(sprite.sprite_clip);
+        SpriteSheet::FrameID frame = clip.first_frame + (SpriteSheet::FrameID)anim_frame;
+        RenderQueue2D::SubmitQuad(transform_comp.Transform(), *sprite.sprite_sheet, frame, quad_comp.color, (uint32_t)quad_entity);
+      }
+      else if (sprite.use and sprite.texture.size() > 0) {
         // Sprite
         if (sprite.use_sub_texture) {
           // Sprite Animation
           if (sprite.sprite_images.size() > 1) {
-            sprite.ResetAnimIndx();
-            Batch2DRenderer::DrawQuad(transform_comp.Transform(), sprite.sprite_images[sprite.anim_idx / sprite.speed], quad_comp.color,
-                                      (uint32_t)quad_entity);
-            sprite.anim_idx++;
+            RenderQueue2D::SubmitQuad(transform_comp.Transform(), sprite.sprite_images[anim_frame], quad_comp.color, (uint32_t)quad_entity);
           }
           // Sprite No Animation
           else if (sprite.sprite_images.size() == 1) {
-            Batch2DRenderer::DrawQuad(transform_comp.Transform(), sprite.sprite_images[0], quad_comp.color, (uint32_t)quad_entity);
+            RenderQueue2D::SubmitQuad(transform_comp.Transform(), sprite.sprite_images[0], quad_comp.color, (uint32_t)quad_entity);
           }
         }
         // Only Texture
         else {
           // Sprite Animation
           if (sprite.texture.size() > 1) {
-            sprite.ResetAnimIndx();
-            Batch2DRenderer::DrawQuad(transform_comp.Transform(), sprite.texture[sprite.anim_idx / sprite.speed], quad_comp.color, sprite.tiling_factor,
+            RenderQueue2D::SubmitQuad(transform_comp.Transform(), sprite.texture[anim_frame], quad_comp.color, sprite.tiling_factor,
                                       (uint32_t)quad_entity);
-            sprite.anim_idx++;
           }
           // Sprite No Animation
           else if (sprite.texture.size() == 1) {
-            Batch2DRenderer::DrawQuad(transform_comp.Transform(), sprite.texture.at(0), quad_comp.color, sprite.tiling_factor, (uint32_t)quad_entity);
+            RenderQueue2D::SubmitQuad(transform_comp.Transform(), sprite.texture.at(0), quad_comp.color, sprite.tiling_factor, (uint32_t)quad_entity);
           }
         }
       }
       else {
-        Batch2DRenderer::DrawQuad(transform_comp.Transform(), quad_comp.color, (uint32_t)quad_entity);
+        RenderQueue2D::SubmitQuad(transform_comp.Transform(), quad_comp.color, (uint32_t)quad_entity);
       }
     } // For each Quad Entity
     
+    // Render the cached static quads (upload only modified chunks). Static quads are culled per chunk, so chunks are not rebuilt when
+    // quads enter or leave the view
+    const uint32_t static_quads = static_batch_2d_->Render(cam_view_proj_mat, view_bounds);
+    stats_2d.sprites_submitted += static_quads;
+    stats_2d.sprites_culled += static_batch_2d_->GetNumQuads() - static_quads;
+    
+    // Sort all the sprites and submit to batch renderer
+    RenderQueue2D::End();
+    
     if (setting_.debug_draw) {
       if (physics_2d_world_) {
         physics_2d_world_->DebugDraw();
@@ -361,6 +658,87 @@ namespace ikan {
     Batch2DRenderer::EndBatch();
   }
   
+  void Scene::UpdateStaticQuads() {
+    for (entt::entity entity : modified_quads_) {
+      if (!registry_.valid(entity))
+        continue;
+      
+      auto* quad_comp = registry_.try_get<QuadComponent>(entity);
+      if (!quad_comp)
+        continue;
+      
+      // Entity is queued once per change of quad and of transform
+      auto* transform_comp = registry_.try_get<TransformComponent>(entity);
+      if (!quad_comp->change_hook.pending and !(transform_comp and transform_comp->change_hook.pending))
+        continue;
+      quad_comp->change_hook.pending = false;
+      
+      if (transform_comp and IsStaticQuad(*quad_comp)) {
+        // Transform of static quad also notifies the change
+        transform_comp->change_hook = quad_comp->change_hook;
+        registry_.remove_if_exists<DynamicQuadTag>(entity);
+        SubmitStaticQuad(entity, *transform_comp, *quad_comp);
+      }
+      else {
+        if (transform_comp)
+          transform_comp->change_hook = ComponentChangeHook();
+        static_batch_2d_->RemoveQuad((uint64_t)entity);
+        if (!registry_.has<DynamicQuadTag>(entity))
+          registry_.emplace<DynamicQuadTag>(entity);
+      }
+    }
+    modified_quads_.clear();
+  }
+  
+  void Scene::SubmitStaticQuad(entt::entity entity, const TransformComponent& transform_comp, const QuadComponent& quad_comp) {
+    const auto& sprite = quad_comp.sprite;
+    if (sprite.use and sprite.texture.size() > 0) {
+      if (sprite.use_sub_texture and sprite.sprite_images.size() == 1) {
+        const auto& sub_texture = sprite.sprite_images[0];
+        TextureHandle texture = sub_texture->GetSpriteHandle();
+        const glm::vec2* coords = sub_texture->GetTexCoord();
+        glm::vec2 atlas_coords[4];
+        if (RemapToTextureAtlas(texture_atlas_.get(), texture, coords, atlas_coords))
+          coords = atlas_coords;
+        static_batch_2d_->SubmitQuad((uint64_t)entity, transform_comp.Transform(), texture, coords, 1.0f /* tiling factor */,
+                                     quad_comp.color, (uint32_t)entity);
+      }
+      else if (!sprite.use_sub_texture) {
+        TextureHandle texture = sprite.texture.at(0);
+        const glm::vec2* coords = texture_coords_;
+        glm::vec2 atlas_coords[4];
+        if (sprite.tiling_factor == 1.0f and RemapToTextureAtlas(texture_atlas_.get(), texture, coords, atlas_coords))
+          coords = atlas_coords;
+        static_batch_2d_->SubmitQuad((uint64_t)entity, transform_comp.Transform(), texture, coords, sprite.tiling_factor,
+                                     quad_comp.color, (uint32_t)entity);
+      }
+      else {
+        // Sub texture enabled without any sprite image renders nothing
+        static_batch_2d_->RemoveQuad((uint64_t)entity);
+      }
+    }
+    else {
+      static_batch_2d_->SubmitQuad((uint64_t)entity, transform_comp.Transform(), nullptr, texture_coords_, 1.0f /* tiling factor */,
+                                   quad_comp.color, (uint32_t)entity);
+    }
+  }
+  
+  void Scene::OnQuadChanged(entt::registry& registry, entt::entity entity) {
+    auto& quad_comp = registry.get<QuadComponent>(entity);
+    quad_comp.change_hook = { &modified_quads_, entity };
+    quad_comp.change_hook.Notify();
+  }
+  
+  void Scene::OnTransformChanged(entt::registry& registry, entt::entity entity) {
+    // Hook of transform is attached again if quad is still static
+    registry.get<TransformComponent>(entity).change_hook = ComponentChangeHook();
+    if (auto* quad_comp = registry.try_get<QuadComponent>(entity))
+      quad_comp->change_hook.Notify();
+  }
+  
+  void Scene::OnQuadRemoved(entt::registry&, entt::entity entity) {
+    static_batch_2d_->RemoveQuad((uint64_t)entity);
+  }
   void Scene::RenderTexts(const glm::mat4& cam_view_proj_mat) {
     TextRenderer::BeginBatch(cam_view_proj_mat);
     
@@ -455,6 +833,7 @@ namespace ikan {
   void Scene::EditScene() {
     IK_CORE_TRACE(LogModule::Scene, "Scene is Set to Edit");
     state_ = State::Edit;
+    FlushDestroyedEntities();
   }
 
   void Scene::SetFilePath(const std::string& file_path) {
@@ -471,6 +850,46 @@ namespace ikan {
     }
   }
   
+  void Scene::SetTextureAtlas(const std::shared_ptr<TextureAtlas>& texture_atlas) {
+    texture_atlas_ = texture_atlas;
+    
+    // Static quads are retained with their old texture coordinates. Queue all the quads to be submitted again
+    static_batch_2d_->Clear();
+    auto quad_view = registry_.view<QuadComponent>();
+    for (const auto& quad_entity : quad_view)
+      quad_view.get<QuadComponent>(quad_entity).change_hook.Notify();
+  }
+  
+  std::vector<std::string> Scene::GetQuadTexturePaths(bool linear) const {
+    // Only textures with filter of atlas pages are packed, others are drawn from their own texture
+    std::vector<std::string> texture_paths;
+    auto add_texture = [&texture_paths, linear](const Texture* texture) {
+      if (texture and texture->IsLinear() == linear and !texture->GetfilePath().empty())
+        texture_paths.push_back(texture->GetfilePath());
+    };
+    
+    auto quad_view = registry_.view<const QuadComponent>();
+    for (const auto& quad_entity : quad_view) {
+      const auto& sprite = quad_view.get<const QuadComponent>(quad_entity).sprite;
+      for (const auto& texture : sprite.texture)
+        add_texture(texture.Get());
+      for (const auto& sub_texture : sprite.sprite_images) {
+        if (sub_texture)
+          add_texture(sub_texture->GetSpriteImage().get());
+      }
+      if (sprite.sprite_sheet)
+        add_texture(sprite.sprite_sheet->GetTexture().get());
+    }
+    return texture_paths;
+  }
+  
+  void Scene::BuildTextureAtlas(const TextureAtlas::Specification& spec) {
+    SetTextureAtlas(TextureAtlas::Create(GetQuadTexturePaths(spec.linear), spec));
+    IK_CORE_INFO(LogModule::Scene, "Texture Atlas of Scene '{0}'", name_);
+    IK_CORE_INFO(LogModule::Scene, "  Textures Packed  {0}", texture_atlas_->GetNumImages());
+    IK_CORE_INFO(LogModule::Scene, "  Atlas Pages      {0}", texture_atlas_->GetNumPages());
+  }
+  
   void Scene::UpdatePrimaryCameraData() {
     auto camera_view = registry_.view<TransformComponent, CameraComponent>();
     for (auto& camera_entity : camera_view) {
@@ -488,9 +907,11 @@ namespace ikan {
   }
 
   Entity* Scene::GetEnitityFromId(int32_t id) {
-    if (entity_id_map_.find((entt::entity)id) != entity_id_map_.end())
-      return &entity_id_map_.at((entt::entity)id);
-    return nullptr;
+    return entity_table_.Find((entt::entity)id);
+  }
+  
+  Entity* Scene::GetEntityFromUUID(UUID uuid) {
+    return entity_table_.Find(uuid_map_.Find(uuid));
   }
 
   void Scene::InstantiateScript(Timestep ts) {
@@ -712,6 +1133,6 @@ namespace ikan {
     return callback;
   }
 
-  bool Scene::IsEntityPresentInMap(entt::entity entity) const { return entity_id_map_.find(entity) != entity_id_map_.end(); }
+  bool Scene::IsEntityPresentInMap(entt::entity entity) const { return entity_table_.Contains(entity); }
 
 } // namespace ikan
@@ -216,7 +216,7 @@ namespace ikan {
   }
   
   void ScenePanelManager::DrawEntityTreeNode(entt::entity entity_id) {
-    Entity& entity = scene_context_->entity_id_map_.at(entity_id);
+    Entity& entity = scene_context_->entity_table_.At(entity_id);
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanAvailWidth |
     ((selected_entity_ and *selected_entity_ == entity) ? ImGuiTreeNodeFlags_Selected : 0);
   
@@ -12,6 +12,32 @@
 #include <yaml-cpp/yaml.h>
 
 namespace ikan {
+  
+  /// This function collects the path and min linear flag of all the textures used by serialized entities
+  /// - Parameter entities: serialized entities
+  static std::vector<std::pair<std::string, bool>> GetTexturePaths(const YAML::Node& entities) {
+    std::vector<std::pair<std::string, bool>> textures;
+    for (auto entity_data : entities) {
+      auto quad_component = entity_data["QuadComponent"];
+      if (!quad_component)
+        continue;
+      
+      bool linear_edge = quad_component["Linear_Edge"].as<bool>();
+      bool has_circle = (bool)entity_data["CircleComponent"];
+      int32_t num_tex = quad_component["Num_Texture_Path"].as<int32_t>();
+      for (int32_t i = 0; i < num_tex; i++) {
+        std::string texture_path = quad_component["Texture_Path_" + std::to_string(i)].as<std::string>();
+        if (texture_path == "")
+          continue;
+        
+        textures.emplace_back(texture_path, linear_edge);
+        // Circle component loads the same textures with linear flag. Image is decoded once for both filters by PreloadTextures
+        if (has_circle)
+          textures.emplace_back(texture_path, true);
+      }
+    }
+    return textures;
+  }
  
   SceneSerializer::SceneSerializer(Scene* scene) : scene_(scene) { }
   SceneSerializer::~SceneSerializer() { }
@@ -34,10 +60,10 @@ namespace ikan {
 
     out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
 
-    // Serialize the scene for all the entities
-    for (const auto& [entt_id, entity] : scene_->entity_id_map_) {
+    // Serialize the scene for all the entities (in the order of entity handle)
+    scene_->entity_table_.Each([&out](const Entity& entity) {
       EntitySerialiser::SerialiseEntity(out, entity);
-    } // // for (const auto& [uuid, entity] : scene_->entity_id_map_)
+    });
     
     std::ofstream fout(file_path);
     fout << out.c_str();
@@ -64,9 +90,19 @@ namespace ikan {
 
     auto entities = data["Entities"];
     if (entities) {
+      // Decode all the textures of scene in parallel before creating entities
+      Renderer::PreloadTextures(GetTexturePaths(entities));
+      scene_->uuid_map_.Reserve((uint32_t)entities.size());
+      
       for (auto entity_data : entities) {
         uint64_t uuid = entity_data["Entity"].as<uint64_t>();
         
+        // UUID should be unique in scene. Entity with duplicate UUID (e.g. merged scene files) gets new UUID
+        if (scene_->GetEntityFromUUID(uuid)) {
+          IK_CORE_WARN(LogModule::SceneSerializer, "  Duplicate Entity ID {0}. Assigning new ID", uuid);
+          uuid = UUID();
+        }
+        
         std::string name;
         auto tag_component = entity_data["TagComponent"];
         name = tag_component["Tag"].as<std::string>();
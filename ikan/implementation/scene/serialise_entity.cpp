@@ -236,6 +236,7 @@ namespace ikan {
       }
       out << YAML::Key << "Texture_TilingFactor" << YAML::Value << qc.sprite.tiling_factor;
       out << YAML::Key << "Color" << YAML::Value << qc.color;
+      out << YAML::Key << "Static" << YAML::Value << qc.is_static;
       
       out << YAML::Key << "Speed" << YAML::Value << qc.sprite.speed;
       
@@ -428,6 +429,8 @@ namespace ikan {
       }
       qc.sprite.tiling_factor = quad_component["Texture_TilingFactor"].as<float>();
       qc.color = quad_component["Color"].as<glm::vec4>();
+      if (quad_component["Static"])
+        qc.is_static = quad_component["Static"].as<bool>();
       
       qc.sprite.speed = quad_component["Speed"].as<int32_t>();
       
@@ -436,7 +439,7 @@ namespace ikan {
         auto coord = quad_component["Coords" + std::to_string(i)].as<glm::vec2>();
         auto sprite_size = quad_component["Sprite_Size" + std::to_string(i)].as<glm::vec2>();
         auto cell_size = quad_component["Cell_Size" + std::to_string(i)].as<glm::vec2>();
-        qc.sprite.sprite_images.push_back(SubTexture::CreateFromCoords(qc.sprite.texture.at(0), coord, sprite_size, cell_size));
+        qc.sprite.sprite_images.push_back(SubTexture::CreateFromCoords(qc.sprite.texture.at(0).GetShared(), coord, sprite_size, cell_size));
       }
       
       IK_CORE_TRACE(LogModule::EntitySerializer, "    Quad Component");
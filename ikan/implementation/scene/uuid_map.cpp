@@ -0,0 +1,122 @@
+//
+//  uuid_map.cpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#include "uuid_map.hpp"
+
+namespace ikan {
+
+  namespace uuid_map_utils {
+
+    /// Minimum number of slots
+    static constexpr uint32_t MinCapacity = 16;
+
+    /// This function returns the smallest power of 2 capacity that keeps the entries at most half full
+    /// - Parameter num_entries: number of entries
+    static uint32_t GetCapacity(uint32_t num_entries) {
+      uint32_t capacity = MinCapacity;
+      while (capacity < num_entries * 2)
+        capacity *= 2;
+      return capacity;
+    }
+
+  } // namespace uuid_map_utils
+
+  uint32_t UUIDMap::GetHomeSlot(uint64_t uuid) const {
+    // Finalizer of splitmix64, as UUIDs given by user (e.g. in scene file) may not be random
+    uuid ^= uuid >> 30;
+    uuid *= 0xbf58476d1ce4e5b9ull;
+    uuid ^= uuid >> 27;
+    uuid *= 0x94d049bb133111ebull;
+    uuid ^= uuid >> 31;
+    return (uint32_t)uuid & ((uint32_t)slots_.size() - 1);
+  }
+
+  void UUIDMap::Insert(uint64_t uuid, entt::entity entity) {
+    IK_ASSERT(entity != entt::null, "Invalid entity handle");
+    if (slots_.empty() or (size_ + 1) * 2 > slots_.size())
+      Rehash(uuid_map_utils::GetCapacity(size_ + 1));
+
+    const uint32_t mask = (uint32_t)slots_.size() - 1;
+    for (uint32_t idx = GetHomeSlot(uuid); ; idx = (idx + 1) & mask) {
+      Slot& slot = slots_[idx];
+      if (slot.entity == entt::null) {
+        slot = { uuid, entity };
+        ++size_;
+        return;
+      }
+      if (slot.uuid == uuid) {
+        slot.entity = entity;
+        return;
+      }
+    }
+  }
+
+  bool UUIDMap::Erase(uint64_t uuid) {
+    if (slots_.empty())
+      return false;
+
+    const uint32_t mask = (uint32_t)slots_.size() - 1;
+    uint32_t idx = GetHomeSlot(uuid);
+    for (; ; idx = (idx + 1) & mask) {
+      if (slots_[idx].entity == entt::null)
+        return false;
+      if (slots_[idx].uuid == uuid)
+        break;
+    }
+
+    // Shift back the following entries of cluster, which can not be found any more if this slot is empty
+    uint32_t hole = idx;
+    for (uint32_t next = (hole + 1) & mask; slots_[next].entity != entt::null; next = (next + 1) & mask) {
+      // Distance from home slot of entry to hole and to its current slot
+      uint32_t home = GetHomeSlot(slots_[next].uuid);
+      if (((hole - home) & mask) < ((next - home) & mask)) {
+        slots_[hole] = slots_[next];
+        hole = next;
+      }
+    }
+    slots_[hole] = Slot();
+    --size_;
+    return true;
+  }
+
+  entt::entity UUIDMap::Find(uint64_t uuid) const {
+    if (slots_.empty())
+      return entt::null;
+
+    const uint32_t mask = (uint32_t)slots_.size() - 1;
+    for (uint32_t idx = GetHomeSlot(uuid); ; idx = (idx + 1) & mask) {
+      const Slot& slot = slots_[idx];
+      if (slot.entity == entt::null)
+        return entt::null;
+      if (slot.uuid == uuid)
+        return slot.entity;
+    }
+  }
+
+  void UUIDMap::Reserve(uint32_t num_entries) {
+    uint32_t capacity = uuid_map_utils::GetCapacity(num_entries);
+    if (capacity > slots_.size())
+      Rehash(capacity);
+  }
+
+  void UUIDMap::Clear() {
+    std::fill(slots_.begin(), slots_.end(), Slot());
+    size_ = 0;
+  }
+
+  void UUIDMap::Rehash(uint32_t capacity) {
+    std::vector<Slot> old_slots = std::move(slots_);
+    slots_.assign(capacity, Slot());
+    size_ = 0;
+
+    for (const auto& slot : old_slots) {
+      if (slot.entity != entt::null)
+        Insert(slot.uuid, slot.entity);
+    }
+  }
+
+} // namespace ikan
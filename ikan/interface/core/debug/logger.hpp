@@ -17,7 +17,7 @@ namespace ikan {
   f(Event) f(StringUtils) \
   f(Application) f(Window) f(DirectoryManager) f(LayerStack) \
   f(Renderer) f(GraphicsContext) f(Batch2DRenderer) f(TextRenderer) \
-  f(Pipeline) f(VertexBuffer) f(IndexBuffer) f(Shader) f(Texture) f(FrameBuffer) f(CharTexture) f(SubTexture) \
+  f(Pipeline) f(VertexBuffer) f(IndexBuffer) f(Shader) f(Texture) f(FrameBuffer) f(CharTexture) f(SubTexture) f(TextureAtlas) \
   f(EditorCamera) f(SceneCamera) f(FixedCamera) \
   f(ContentBrowserPanel) \
 f(Scene) f(ScenePanelManager) f(SceneSerializer) f(Entity) f(Component) f(Prefab) f(EntitySerializer) \
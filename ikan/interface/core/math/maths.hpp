@@ -34,6 +34,39 @@ namespace ikan {
     /// This function conerts the Cartisian point to Isometric
     /// - Parameter cartisian: cartisian point
     [[nodiscard]] static glm::vec2 GetIsometricFromCartesian(const glm::vec2& cartisian);
+    
+    /// This function generates the 4 corners of a 2D quad rotated around z axis. Corners are in the order of Batch renderer quad
+    /// vertices: (-x, -y), (+x, -y), (+x, +y), (-x, +y). Uses SSE / NEON when available
+    /// - Parameters:
+    ///   - center: center of quad
+    ///   - half_extent: half of the size of quad
+    ///   - cos_rotation: cosine of rotation angle
+    ///   - sin_rotation: sine of rotation angle
+    ///   - out_x: x of 4 corners output
+    ///   - out_y: y of 4 corners output
+    static void GetQuadCorners2D(const glm::vec2& center, const glm::vec2& half_extent, float cos_rotation, float sin_rotation,
+                                 float out_x[4], float out_y[4]);
+    /// This function is the scalar reference of GetQuadCorners2D. Same arguments and output
+    static void GetQuadCorners2DScalar(const glm::vec2& center, const glm::vec2& half_extent, float cos_rotation, float sin_rotation,
+                                       float out_x[4], float out_y[4]);
+    /// This function generates the 4 corners of many 2D quads rotated around z axis. Vectorized across quads: 8 quads per iteration
+    /// with AVX (selected at runtime), 4 with SSE / NEON, rest are scalar. Corners of each quad are stored contiguously in the order
+    /// of GetQuadCorners2D
+    /// - Parameters:
+    ///   - count: number of quads
+    ///   - centers: center of each quad (z is ignored)
+    ///   - half_extents: half of the size of each quad
+    ///   - cos_rotations: cosine of rotation angle of each quad. nullptr if quads are not rotated
+    ///   - sin_rotations: sine of rotation angle of each quad. nullptr if quads are not rotated
+    ///   - out_x: x of corners output (4 * count)
+    ///   - out_y: y of corners output (4 * count)
+    static void GetQuadCorners2DBulk(size_t count, const glm::vec3* centers, const glm::vec2* half_extents, const float* cos_rotations,
+                                     const float* sin_rotations, float* out_x, float* out_y);
+    /// This function checks that GetQuadCorners2D and GetQuadCorners2DBulk (SIMD) match the scalar reference within epsilon for random
+    /// inputs. Each mismatch is logged
+    /// - Parameter num_samples: number of random inputs to be checked
+    /// - Returns: number of mismatched corners
+    [[nodiscard]] static uint32_t ValidateQuadCorners2D(uint32_t num_samples = 1000);
 
     MAKE_PURE_STATIC(Math);
   };
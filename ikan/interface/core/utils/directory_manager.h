@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <filesystem>
+
 namespace ikan {
   
   struct Font {
@@ -42,6 +44,9 @@ namespace ikan {
     /// This function returns the Workspace
     /// - Important: Returned path is relative to .exce and upto the folder name of 'Assets'
     static const std::string& GetWorkspaceBasePath() { return workspace_path_; }
+    /// This function returns the folder of generated cache files (decoded textures, glyphs ...)
+    /// - Important: Returned path is relative to .exce and inside the Workspace
+    static std::string GetCacheBasePath() { return workspace_path_ + ".ikan_cache/"; }
 
     /// This function returns the path relative to the executable form the path relative to workspace
     /// - Parameter path: Aasset path relative to workspace folder:
@@ -52,6 +57,29 @@ namespace ikan {
     /// This function returns the path relative to client Asset path
     /// - Parameter asset_path: Aasset path relative to asset folder:
     static std::string ClientAsset(const std::string& asset_path) { return client_asset_path_ + asset_path; }
+    /// This function returns the path of cache file generated from a source file. Cache is not stored next to source (asset folders
+    /// are tracked), but in cache folder with name keyed by hash of source path, so same file names in different folders do not collide
+    /// - Parameters:
+    ///   - source_path: path of source file (image, font ...)
+    ///   - extension: extension of cache file (with '.')
+    static std::string CacheFile(const std::string& source_path, const std::string& extension) {
+      const std::filesystem::path path = std::filesystem::path(source_path).lexically_normal();
+      
+      // FNV-1a hash of source path. Stable across runs (unlike std::hash)
+      uint64_t hash = 14695981039346656037ull;
+      for (char c : path.string()) {
+        hash ^= (uint8_t)c;
+        hash *= 1099511628211ull;
+      }
+      
+      char hash_str[17];
+      std::snprintf(hash_str, sizeof(hash_str), "%016llx", (unsigned long long)hash);
+
+      const std::string cache_dir = GetCacheBasePath();
+      std::error_code error;
+      std::filesystem::create_directories(cache_dir, error);
+      return cache_dir + path.filename().string() + "." + hash_str + extension;
+    }
 
     MAKE_PURE_STATIC(DirectoryManager);
     
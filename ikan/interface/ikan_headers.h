@@ -61,12 +61,16 @@
 // Renderer Files
 #include <renderer/utils/renderer.hpp>
 #include <renderer/utils/batch_2d_renderer.hpp>
+#include <renderer/utils/render_queue_2d.hpp>
+#include <renderer/utils/static_batch_2d.hpp>
 #include <renderer/utils/text_renderer.hpp>
 
 #include <renderer/graphics/pipeline.hpp>
 #include <renderer/graphics/renderer_buffer.hpp>
 #include <renderer/graphics/shader.hpp>
 #include <renderer/graphics/texture.hpp>
+#include <renderer/graphics/texture_atlas.hpp>
+#include <renderer/graphics/sprite_sheet.hpp>
 #include <renderer/graphics/framebuffer.hpp>
 
 // Editor Files
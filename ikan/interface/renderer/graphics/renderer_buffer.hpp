@@ -17,7 +17,9 @@ namespace ikan {
     Float, Float2, Float3, Float4,
     Mat3, Mat4,
     Int, Int2, Int3, Int4,
-    Bool
+    Bool,
+    // Packed types (e.g. compact vertex attributes). Shader reads them as float
+    Half2, UByte4
   };
 
   /// This structur stores all the property of a element in a buffer.
@@ -28,13 +30,16 @@ namespace ikan {
     uint32_t count = 0;
     size_t offset = 0;
     bool normalized = false;
+    /// Instance divisor of element. 0 means per vertex attribute, 1 means advances once per instance
+    uint32_t divisor = 0;
     
     /// This Constructor creates the buffer element with arguments
     /// - Parameters:
     ///   - name: name of element
     ///   - type: type of element
     ///   - normalized: flag is element normalized
-    BufferElement(const std::string& name, ShaderDataType type, bool normalized = false);
+    ///   - divisor: instance divisor of element (0 for per vertex data)
+    BufferElement(const std::string& name, ShaderDataType type, bool normalized = false, uint32_t divisor = 0);
   };
   
   /// This class stores the layout of vertex Buffer in a vector (stores each elements)
@@ -87,6 +92,10 @@ namespace ikan {
     ///   - data: Data pointer to be stored in GPU
     ///   - size: size of data
     virtual void SetData(void* data, uint32_t size) = 0;
+    /// This function reallocates the dynamic buffer storage with new size. Previous data is discarded, but buffer (and its binding in
+    /// pipeline) remains same
+    /// - Parameter size: new size of buffer
+    virtual void Resize(uint32_t size) = 0;
     /// This function binds the Vertex Buffer before rendering
     virtual void Bind() const = 0;
     /// This function unbinds the Vertex Buffer after rendering
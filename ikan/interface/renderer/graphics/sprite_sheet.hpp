@@ -0,0 +1,97 @@
+//
+//  sprite_sheet.hpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "renderer/graphics/texture.hpp"
+
+namespace ikan {
+
+  /// This class stores the frames of a sprite sheet texture as flyweight UV rects. Frames are stored contiguously and addressed by
+  /// small integer IDs, and animation clips are ranges of frames.
+  ///   - Sprite stores only the sheet and clip ID, so switching animation is an integer assignment (no SubTexture allocation or copy)
+  ///   - Renderer reads UV rects of frames from one contiguous array
+  class SpriteSheet {
+  public:
+    using FrameID = uint16_t;
+    using ClipID = uint16_t;
+
+    /// This structure stores the cell of frame in sprite sheet
+    struct Frame {
+      /// Coordinates of frame in cells from bottom left of texture
+      glm::vec2 coords = { 0.0f, 0.0f };
+      /// Number of cells taken by frame
+      glm::vec2 sprite_size = { 1.0f, 1.0f };
+    };
+    /// This structure stores the range of frames of animation clip
+    struct Clip {
+      FrameID first_frame = 0;
+      uint16_t num_frames = 0;
+    };
+
+    /// This function creates the sprite sheet of texture
+    /// - Parameters:
+    ///   - texture: sprite sheet texture
+    ///   - cell_size: size of one cell in pixels
+    static std::shared_ptr<SpriteSheet> Create(const std::shared_ptr<Texture>& texture, const glm::vec2& cell_size = { 16.0f, 16.0f });
+
+    /// This function adds a frame in sheet and returns its ID
+    /// - Parameters:
+    ///   - coords: coordinates of frame in cells
+    ///   - sprite_size: number of cells taken by frame
+    FrameID AddFrame(const glm::vec2& coords, const glm::vec2& sprite_size = { 1.0f, 1.0f });
+    /// This function adds the frames of clip contiguously in sheet and returns the clip ID
+    /// - Parameter frames: frames of clip in animation order
+    ClipID AddClip(const std::vector<Frame>& frames);
+    /// This function adds the clip of frames already in sheet and returns the clip ID
+    /// - Parameters:
+    ///   - first_frame: first frame of clip
+    ///   - num_frames: number of frames in clip
+    ClipID AddClip(FrameID first_frame, uint16_t num_frames);
+
+    /// This function returns the UV rect (min u, min v, max u, max v) of frame
+    /// - Parameter frame: frame ID
+    const glm::vec4& GetFrameUV(FrameID frame) const { return frame_uvs_[frame]; }
+    /// This function returns the clip
+    /// - Parameter clip: clip ID
+    const Clip& GetClip(ClipID clip) const { return clips_[clip]; }
+    /// This function returns the frame of clip at animation index. Index wraps around the clip
+    /// - Parameters:
+    ///   - clip: clip ID
+    ///   - index: animation index
+    FrameID GetClipFrame(ClipID clip, uint32_t index) const {
+      const Clip& c = clips_[clip];
+      return c.first_frame + (FrameID)(c.num_frames > 1 ? index % c.num_frames : 0);
+    }
+
+    /// This function returns the texture of sheet
+    const std::shared_ptr<Texture>& GetTexture() const { return texture_; }
+    /// This function returns the texture handle of sheet
+    TextureHandle GetTextureHandle() const { return texture_handle_; }
+    /// This function returns the cell size of sheet in pixels
+    const glm::vec2& GetCellSize() const { return cell_size_; }
+    /// This function returns the number of frames
+    uint32_t GetNumFrames() const { return (uint32_t)frame_uvs_.size(); }
+    /// This function returns the number of clips
+    uint32_t GetNumClips() const { return (uint32_t)clips_.size(); }
+
+    /// This constructor creates the sprite sheet of texture. Use Create()
+    /// - Parameters:
+    ///   - texture: sprite sheet texture
+    ///   - cell_size: size of one cell in pixels
+    SpriteSheet(const std::shared_ptr<Texture>& texture, const glm::vec2& cell_size);
+    DELETE_COPY_MOVE_CONSTRUCTORS(SpriteSheet);
+
+  private:
+    std::shared_ptr<Texture> texture_;
+    TextureHandle texture_handle_;
+    glm::vec2 cell_size_;
+    std::vector<glm::vec4> frame_uvs_;
+    std::vector<Clip> clips_;
+  };
+
+} // namespace ikan
@@ -19,7 +19,74 @@ namespace ikan {
     None = 0, RGBA
   };
 
-  class Texture {
+  /// This structure stores the pixels of decoded image file. Decoding do not need graphics context, so images can be decoded on
+  /// worker threads and uploaded later on renderer thread.
+  ///   - Decoded pixels are cached in '.iktex' file of cache folder (flipped RGBA8 pixels and optional mip levels). Cache is mapped
+  ///     with mmap on next load, so image is not decoded again. Cache is regenerated when size or modification time of image file changes
+  struct TextureImage {
+    std::string file_path;
+    int32_t width = 0, height = 0, channels = 0;
+    /// Number of mip levels stored in pixels (level 0 first, each level half the size of previous)
+    uint32_t num_levels = 1;
+    /// Decoded pixels (nullptr if failed to decode)
+    std::shared_ptr<uint8_t> pixels;
+    /// True if pixels are mapped from texture cache (warm load), false if image file is decoded (cold load)
+    bool from_cache = false;
+    
+    /// This function decodes the image file, flipped vertically as Open GL reads rows from bottom (Thread safe)
+    /// - Parameter file_path: path of image file
+    static TextureImage Decode(const std::string& file_path);
+    /// This function enables the precomputed mip levels in texture cache. Default disabled
+    /// - Parameter enable: flag to store mip levels
+    static void SetCacheMipLevels(bool enable);
+  };
+
+  class Texture;
+  
+  /// This class is the generational 32 bit handle of texture in handle table of TextureLibrary. Copying a handle is a plain copy (no
+  /// reference counting), so components and batches store handles while shared ownership stays at library level.
+  ///   - Handle of library texture stays valid when texture is evicted. Texture is loaded again when handle is resolved
+  ///   - Handle of any other texture gets stale (resolves to nullptr) once texture is destroyed. Its slot is reused with next generation
+  class TextureHandle {
+  public:
+    TextureHandle() = default;
+    TextureHandle(std::nullptr_t) { }
+    /// This constructor returns the handle of texture. Texture is added in handle table if not added already
+    /// - Parameter texture: texture
+    TextureHandle(const std::shared_ptr<Texture>& texture);
+    
+    /// This function returns the texture of handle. Returns nullptr if handle is null or stale
+    Texture* Get() const;
+    /// This function returns the shared pointer of texture. Returns nullptr if handle is null or stale. NOTE: Use Get() in hot paths
+    std::shared_ptr<Texture> GetShared() const;
+    /// This function marks the library texture of handle in use without resolving it, so that texture is not evicted (and not loaded
+    /// again if evicted already). Scene marks the textures of culled sprites, so that they do not flicker when they come back in view
+    void MarkInUse() const;
+    
+    Texture* operator->() const { return Get(); }
+    explicit operator bool() const { return Get() != nullptr; }
+    bool operator==(const TextureHandle& other) const { return value_ == other.value_; }
+    bool operator!=(const TextureHandle& other) const { return value_ != other.value_; }
+    
+    /// This function returns the packed value of handle (0 for null handle)
+    uint32_t GetValue() const { return value_; }
+    
+  private:
+    static constexpr uint32_t IndexBits = 20;
+    static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+    static constexpr uint32_t MaxGeneration = (1u << (32 - IndexBits)) - 1;
+    
+    TextureHandle(uint32_t index, uint32_t generation) : value_((generation << IndexBits) | index) { }
+    uint32_t GetIndex() const { return value_ & IndexMask; }
+    uint32_t GetGeneration() const { return value_ >> IndexBits; }
+    
+    // | Generation (12) | Index (20) |. Generation starts from 1, so 0 is null handle
+    uint32_t value_ = 0;
+    
+    friend class TextureLibrary;
+  };
+
+  class Texture : public std::enable_shared_from_this<Texture> {
   public:
     /// This static functions creates Emptry Texture with user Defined Data of size height and Width
     /// - Parameters:
@@ -27,14 +94,21 @@ namespace ikan {
     ///   - height Height of Empty Texture
     ///   - data: Data to be stored in Empty Texture
     ///   - size: Size of type of data stored in Texture
-    static std::shared_ptr<Texture> Create(uint32_t width, uint32_t height, void* data, uint32_t size);
+    ///   - linear: min linear flag
+    static std::shared_ptr<Texture> Create(uint32_t width, uint32_t height, void* data, uint32_t size, bool linear = true);
     /// This static functions creates the Texture from image file
     /// - Parameters:
     ///   - file_path: path of texture file
     ///   - linear: min linear flag
     static std::shared_ptr<Texture> Create(const std::string& file_path, bool linear = true);
+    /// This static functions creates the Texture from decoded image
+    /// - Parameters:
+    ///   - image: decoded image
+    ///   - linear: min linear flag
+    static std::shared_ptr<Texture> Create(const TextureImage& image, bool linear = true);
 
-    virtual ~Texture() = default;
+    /// Destructor makes the handle of texture stale
+    virtual ~Texture();
     
     /// This function binds the Current Texture to a slot of shader
     /// - Parameter slot: Slot of shader
@@ -48,10 +122,14 @@ namespace ikan {
     virtual uint32_t GetWidth() const = 0;
     /// This function returns the Height of Texture
     virtual uint32_t GetHeight() const = 0;
+    /// This function returns the Size of Texture in bytes (All mip levels)
+    virtual uint32_t GetSize() const = 0;
     /// This function returns the File Path of Texture NOTE: Return "" for white texture
     virtual const std::string& GetfilePath() const = 0;
     /// This function returns name of texture
     virtual const std::string& GetName() const = 0;
+    /// This function returns true if texture uses linear min and mag filter (nearest otherwise)
+    virtual bool IsLinear() const = 0;
   };
   
   /// Wrepper class to load texture and render as sprite
@@ -79,6 +157,8 @@ namespace ikan {
     
     /// This function returns the texture reference of sprite
     std::shared_ptr<Texture> GetSpriteImage();
+    /// This function returns the handle of sprite texture (resolved once at construction)
+    TextureHandle GetSpriteHandle() const;
     /// This function returns Texture coordinates of Subtexture
     const glm::vec2* GetTexCoord() const;
     /// This function returns Sprite size of Subtexture
@@ -103,6 +183,7 @@ namespace ikan {
     
   private:
     std::shared_ptr<Texture> sprite_image_;
+    TextureHandle sprite_handle_;
     glm::vec2 texture_coord_[4];
     glm::vec2 sprite_size_;
     glm::vec2 cell_size_;
@@ -121,6 +202,11 @@ namespace ikan {
     ///   - char_val: character value
     static std::shared_ptr<CharTexture> Create(const FT_Face& face, const glm::ivec2& size, const glm::ivec2& bearing,
                                                uint32_t advance, [[maybe_unused]] char char_val);
+    /// This function creates single channel Texture to store many packed glyphs (Glyph atlas page). Bearing and advance are 0
+    /// - Parameters:
+    ///   - size: size of atlas page in pixels
+    ///   - data: single channel pixels of page (size.x * size.y bytes)
+    static std::shared_ptr<CharTexture> Create(const glm::ivec2& size, const void* data);
 
     virtual ~CharTexture() = default;
     
@@ -129,6 +215,12 @@ namespace ikan {
     virtual void Bind(uint32_t slot = 0) const = 0;
     /// This function unbinds the Current Texture from shader slot
     virtual void Unbind() const = 0;
+    /// This function updates the pixels of a region of texture (e.g. a glyph in atlas page)
+    /// - Parameters:
+    ///   - offset: offset of region in pixels
+    ///   - size: size of region in pixels
+    ///   - data: single channel pixels of region (size.x * size.y bytes)
+    virtual void SetSubData(const glm::ivec2& offset, const glm::ivec2& size, const void* data) = 0;
     
     /// This function returns the Renderer ID of Texture
     virtual RendererID GetRendererID() const = 0;
@@ -144,25 +236,113 @@ namespace ikan {
     virtual uint32_t GetAdvance() const = 0;
   };
   
-  /// This class stores the compiled Texture in library
+  /// This class stores the compiled Texture in library.
+  ///   - Textures not in use are evicted in least recently used order, when resident size exceeds the budget. Texture is in use if
+  ///     it is referenced outside library, or its handle is resolved (drawn) or marked in use in last few frames.
+  ///     Evicted texture is loaded again on next request (asynchronously if requested by handle)
   class TextureLibrary {
   private:
+    /// Texture stored in library with its usage
+    struct TextureEntry {
+      std::shared_ptr<Texture> texture;
+      /// Handle of texture. Same handle is used when texture is loaded again after eviction
+      TextureHandle handle;
+      /// Number of times texture is requested from library
+      uint32_t num_requests = 0;
+      /// Last frame in which texture was requested or referenced outside library
+      uint64_t last_used_frame = 0;
+    };
+    
+    /// Slot of handle table
+    struct HandleSlot {
+      Texture* texture = nullptr;
+      /// Path and filter of library texture, to load it again after eviction. Empty for other textures
+      std::string path;
+      bool linear = true;
+      uint32_t generation = 1;
+      /// Last frame in which handle was resolved
+      uint64_t last_used_frame = 0;
+    };
+    
+    static constexpr size_t DefaultBudget = 256 * 1024 * 1024;
+    /// Texture whose handle is resolved within these many frames is not evicted
+    static constexpr uint64_t PinnedFrames = 3;
+    
+
     /// This function returns the Ref type of ikan::Texture. It creates a new if not present in the map
     /// - Parameters:
     ///   - path: path of textre
     ///   - linear: min linear flag
     static std::shared_ptr<Texture> GetTexture(const std::string& path, bool linear = true);
+    /// This function returns the texture without blocking. If not loaded, it returns a placeholder handle (1x1 transparent) and
+    /// decodes the image on worker thread. Handle starts rendering the texture once Update() uploads it. NOTE: Width and
+    /// height of handle are of placeholder till then
+    /// - Parameters:
+    ///   - path: path of textre
+    ///   - linear: min linear flag
+    static std::shared_ptr<Texture> GetTextureAsync(const std::string& path, bool linear = true);
+    /// This function decodes the images in parallel on worker threads, then uploads them in order on calling (renderer) thread.
+    /// Already loaded textures are skipped. Image needed with both linear and nearest filter is decoded once
+    /// - Parameter textures: path and min linear flag of each texture
+    static void PreloadTextures(const std::vector<std::pair<std::string, bool>>& textures);
+    /// This function uploads the images decoded by GetTextureAsync() and evicts the least recently used textures not in use, till
+    /// resident size is in budget. Should be called on renderer thread each frame
+    static void Update();
+    /// This function sets the budget of resident texture memory
+    /// - Parameter bytes: budget in bytes
+    static void SetBudget(size_t bytes);
+    /// This function shows the resident textures with their size and usage in gui widget
+    /// - Parameter is_open: flag to show or hide the widget
+    static void RenderGui(bool* is_open = nullptr);
     /// This function deletes all the Texture present int the map
     static void ResetTextures();
     
+    /// This function returns the handle of texture. Adds the texture in handle table if not added already
+    /// - Parameter texture: texture
+    static TextureHandle GetHandle(const std::shared_ptr<Texture>& texture);
+    /// This function returns the texture of handle. Returns nullptr if handle is stale. Evicted library texture is loaded again
+    /// asynchronously, and placeholder (1x1 transparent) is rendered till it is uploaded, so that render loop never blocks on load
+    /// - Parameter handle: handle of texture
+    static Texture* Resolve(TextureHandle handle);
+    /// This function marks the handle in use in current frame without loading the evicted texture
+    /// - Parameter handle: handle of texture
+    static void MarkInUse(TextureHandle handle);
+    /// This function checks if texture of library entry is in use: referenced outside library or its handle resolved in last
+    /// PinnedFrames frames
+    /// - Parameter entry: library entry
+    static bool IsInUse(const TextureEntry& entry);
+    /// This function stores the texture of library entry in its handle slot. Allocates the slot for new entry
+    /// - Parameters:
+    ///   - entry: library entry
+    ///   - path: path of texture
+    ///   - linear: min linear flag
+    static void UpdateHandle(TextureEntry& entry, const std::string& path, bool linear);
+    /// This function allocates a new slot in handle table
+    static uint32_t AllocateHandleSlot();
+    /// This function frees the slot of handle table. Generation is incremented, so all the handles of slot get stale
+    /// - Parameter index: index of slot
+    static void FreeHandleSlot(uint32_t index);
+    /// This function removes the destroyed texture from handle table. Called by destructor of texture
+    /// - Parameter texture: destroyed texture
+    static void ReleaseHandle(const Texture* texture);
+    
     // Array of 2 to keep both linear and nearest min and mag flags
-    // 0 -> Linear Filter
-    // 1 -> Nearest Filter
-    static std::unordered_map<std::string, std::array<std::shared_ptr<Texture>, 2>> texture_library_;
+    // 0 -> Nearest Filter
+    // 1 -> Linear Filter
+    static std::unordered_map<std::string, std::array<TextureEntry, 2>> texture_library_;
+    static size_t budget_;
+    static uint64_t frame_;
+    
+    // Handle table
+    static std::vector<HandleSlot> handle_slots_;
+    static std::vector<uint32_t> free_handle_slots_;
+    static std::unordered_map<const Texture*, uint32_t> texture_handles_;
     
     MAKE_PURE_STATIC(TextureLibrary)
     
     friend class Renderer;
+    friend class Texture;
+    friend class TextureHandle;
   };
   
 } // namespace ikan
@@ -0,0 +1,90 @@
+//
+//  texture_atlas.hpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "renderer/graphics/texture.hpp"
+
+namespace ikan {
+
+  /// This class packs many sprite textures in few large atlas pages, so that the batch renderer binds a handful of textures instead of
+  /// one per sprite image.
+  ///   - Images are packed with skyline (bottom left) packer. Edge pixels are extruded in padding so that linear filter do not bleed
+  ///   - Each packed image is stored as SubTexture of its page, and sprite UVs are remapped in this region with Remap()
+  ///   - Atlas can be packed offline with Pack() (no graphics context needed) and loaded at runtime with Load()
+  ///   - All pages use the filter of specification. Only textures with same filter are remapped, so a nearest filtered sprite is
+  ///     never drawn blurred from a linear page (region is found by path and filter of texture)
+  ///   - Note: Only RGB/RGBA images smaller than page are packed. Tiled textures can not be remapped (page do not repeat)
+  class TextureAtlas {
+  public:
+    /// This structure stores the specification of atlas
+    struct Specification {
+      /// Width and height of each page in pixels
+      uint32_t page_size = 2048;
+      /// Extruded pixels around each image
+      uint32_t padding = 1;
+      /// Min and mag linear filter of pages
+      bool linear = true;
+    };
+
+    /// This function packs the images and creates the atlas pages
+    /// - Parameters:
+    ///   - texture_paths: paths of images
+    ///   - spec: specification of atlas
+    static std::shared_ptr<TextureAtlas> Create(const std::vector<std::string>& texture_paths, const Specification& spec = Specification());
+    /// This function loads the atlas packed offline with Pack() (single read of file)
+    /// - Parameter atlas_file_path: path of atlas file
+    static std::shared_ptr<TextureAtlas> Load(const std::string& atlas_file_path);
+    /// This function packs the images and writes the pages and regions in atlas file (offline packing step). Returns false if file
+    /// can not be written
+    /// - Parameters:
+    ///   - texture_paths: paths of images
+    ///   - atlas_file_path: path of atlas file
+    ///   - spec: specification of atlas
+    static bool Pack(const std::vector<std::string>& texture_paths, const std::string& atlas_file_path,
+                     const Specification& spec = Specification());
+    /// This function returns the paths of all image files (png, jpg) in directory and its sub directories
+    /// - Parameter directory: directory path
+    static std::vector<std::string> GetImagesInDirectory(const std::string& directory);
+
+    /// This function remaps the UVs of texture to its region in atlas. Returns false if texture is not in atlas or its filter is not
+    /// same as of pages
+    /// - Parameters:
+    ///   - texture: texture of sprite
+    ///   - uv_rect: uv rect in texture (min u, min v, max u, max v). Replaced by uv rect in atlas page
+    ///   - page: atlas page of texture (output)
+    bool Remap(TextureHandle texture, glm::vec4& uv_rect, TextureHandle& page) const;
+    /// This function returns the sub texture (page and UVs) of image. Returns nullptr if image is not in atlas
+    /// - Parameter texture_path: path of image
+    std::shared_ptr<SubTexture> GetSubTexture(const std::string& texture_path) const;
+
+    /// This function returns true if pages use linear filter (nearest otherwise)
+    bool IsLinear() const { return linear_; }
+    /// This function returns the number of atlas pages
+    uint32_t GetNumPages() const { return (uint32_t)pages_.size(); }
+    /// This function returns the number of images packed in atlas
+    uint32_t GetNumImages() const { return (uint32_t)regions_.size(); }
+
+    /// This constructor creates the atlas from packed pages. Use Create() or Load()
+    /// - Parameters:
+    ///   - pages: atlas pages
+    ///   - regions: sub texture of each image path
+    ///   - linear: filter of pages
+    TextureAtlas(std::vector<std::shared_ptr<Texture>>&& pages, std::unordered_map<std::string, std::shared_ptr<SubTexture>>&& regions,
+                 bool linear);
+    DELETE_COPY_MOVE_CONSTRUCTORS(TextureAtlas);
+
+  private:
+    std::vector<std::shared_ptr<Texture>> pages_;
+    std::unordered_map<std::string, std::shared_ptr<SubTexture>> regions_;
+    bool linear_ = true;
+    /// Region of each texture handle (nullptr if not in atlas or filter differs), cached to avoid path lookup for each sprite. Handle value has the
+    /// generation, so a destroyed texture never aliases a new one
+    mutable std::unordered_map<uint32_t, const SubTexture*> texture_regions_;
+  };
+
+} // namespace ikan
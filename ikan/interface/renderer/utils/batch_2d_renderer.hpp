@@ -7,37 +7,86 @@
 
 #pragma once
 
+#include "renderer/graphics/texture.hpp"
+#include "renderer/graphics/sprite_sheet.hpp"
+#include <span>
+
 namespace ikan {
-  
-  class Texture;
-  class SubTexture;
 
   class Batch2DRenderer {
   public:
+    /// Vertex format of Quad and Circle batches
+    enum class VertexFormat : uint8_t {
+      /// Float color, UV, texture index and tiling factor in each vertex
+      Full,
+      /// RGBA8 color, half float UV (tiling factor folded in) and uint8 texture index. Uses the packed shaders
+      Packed,
+      /// Quads are uploaded as one instance record (2D affine, UV rect, RGBA8 color, texture index and object id) and the vertex
+      /// shader expands the unit quad. Circles use Full format
+      Instanced,
+      /// Quads, circles and rounded rects share one batch (one vertex format with shape kind and one shader), so mixed shapes are
+      /// rendered in submission order without per shape flushes
+      Unified
+    };
+    
+    /// Kind of shape stored in vertex of Unified batch
+    enum class ShapeKind : uint8_t {
+      Quad = 0, Circle = 1, RoundedRect = 2
+    };
+    
+    /// Structure of arrays of 2D Quads for bulk submission. Each non empty span should have same size as positions (or transforms)
+    struct Quads2D {
+      /// Transformation matrix of each quad. If not empty then positions, half extents and rotations are ignored
+      std::span<const glm::mat4> transforms;
+      /// Center of each quad. z is used as depth
+      std::span<const glm::vec3> positions;
+      /// Half of the size of each quad
+      std::span<const glm::vec2> half_extents;
+      /// Rotation of each quad around z axis in radians. Empty for no rotation
+      std::span<const float> rotations;
+      /// Color of each quad. Empty for white
+      std::span<const glm::vec4> colors;
+      /// Texture coordinates of each quad as (min u, min v, max u, max v). Empty for full texture
+      std::span<const glm::vec4> uv_rects;
+      /// Texture of each quad. Empty (or null handle) for white texture
+      std::span<const TextureHandle> textures;
+      /// Pixel ID of each quad. Empty for -1
+      std::span<const int32_t> object_ids;
+    };
+
     /// This function initialzes the Batch renderer. Create All buffers needed to store Data (Both Renderer and CPU)
+    ///   - Capacity of each batch adapts to the observed peaks once per frame (AdaptCapacity()): grows when a frame needs more than one flush
+    ///     because batch is full, and shrinks (not below the initial capacity) when peak flush stays under a quarter of capacity
     /// - Parameters:
-    ///   - max_quads: Max Quad to render in one batch
-    ///   - max_cirlces: Max Circles to render in one batch
-    ///   - max_lines: Max Lines to render in one batch
-    static void Initialise(uint32_t max_quads, uint32_t max_cirlces, uint32_t max_lines);
+    ///   - max_quads: Initial (and min) Quads to render in one batch
+    ///   - max_cirlces: Initial (and min) Circles to render in one batch
+    ///   - max_lines: Initial (and min) Lines to render in one batch
+    ///   - vertex_format: Vertex format of Quad and Circle batches
+    static void Initialise(uint32_t max_quads = 100, uint32_t max_cirlces = 100, uint32_t max_lines = 100,
+                           VertexFormat vertex_format = VertexFormat::Full);
     /// This functio dhutdown the batch renderer and destoy all the buffer reserved on initialize
     static void Shutdown();
     /// This function Dump the data in logs
     static void LogData();
+    /// This function returns the vertex format of Quad and Circle batches
+    static VertexFormat GetVertexFormat();
     
-    /// This function begins the Batch for 2D Rendere (to be called each frame)
+    /// This function begins the Batch for 2D Rendere (can be called multiple times in a frame, e.g. scene and overlays)
     /// - Parameter cam_view_proj_mat: Camera View projection Matrix
     static void BeginBatch(const glm::mat4& cam_view_proj_mat);
     /// This function Ends the current batch by rendering all the vertex
     static void EndBatch();
+    /// This function updates the batch capacity from the flushes of previous frame. To be called once per frame (outside any batch),
+    /// before the renderer stats of previous frame are reset
+    static void AdaptCapacity();
 
-    /// This funcition Adds the quads renderer data to prev allocaged data
+    /// This funcition Adds the quads renderer data to prev allocaged data. Raises the min capacity of adaptive batch
     /// - Parameter max_quads: max quad to be renderered in single batch
     static void AddQuadData(uint32_t max_quads);
-    /// This funcition Adds the circle renderer data to prev allocaged data
+    /// This funcition Adds the circle renderer data to prev allocaged data. Raises the min capacity of adaptive batch
     /// - Parameter max_circles: max circle to be renderered in single batch
     static void AddCircleData(uint32_t max_circles);
-    /// This funcition Adds the lines renderer data to prev allocaged data
+    /// This funcition Adds the lines renderer data to prev allocaged data. Raises the min capacity of adaptive batch
     /// - Parameter max_lines: max circle to be renderered in single batch
     static void AddLineData(uint32_t max_lines);
 
@@ -63,7 +112,7 @@ namespace ikan {
     ///   - tint_color: Color of Quad
     ///   - tiling_factor: tiling factor of Texture (Scale by which texture to be Multiplied)
     ///   - object_id: Pixel ID of Quad
-    static void DrawQuad(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, const glm::vec4& tint_color = glm::vec4(1.0f),
+    static void DrawQuad(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color = glm::vec4(1.0f),
                          float tiling_factor = 1.0f, int32_t object_id = -1 );
     /// This function draws Quad with Subtexture sprite
     /// - Parameters:
@@ -72,6 +121,31 @@ namespace ikan {
     ///   - object_id: entity ID of Quad
     static void DrawQuad(const glm::mat4& transform, const std::shared_ptr<SubTexture>& sub_texture, const glm::vec4& tint_color = glm::vec4(1.0f),
                          int32_t object_id = -1);
+    /// This function draws Quad with frame of sprite sheet
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Quad
+    ///   - sprite_sheet: sprite sheet
+    ///   - frame: frame ID in sprite sheet
+    ///   - tint_color: Color of Quad
+    ///   - object_id: entity ID of Quad
+    static void DrawQuad(const glm::mat4& transform, const SpriteSheet& sprite_sheet, SpriteSheet::FrameID frame,
+                         const glm::vec4& tint_color = glm::vec4(1.0f), int32_t object_id = -1);
+    /// This function draws all the 2D Quads in bulk. Corners are generated directly from position, half extent and rotation (using
+    /// SIMD) instead of multiplying each vertex with transform matrix
+    ///   - Batches (and texture slots) are planned serially, so draw calls are same as submitting each quad with DrawQuad
+    ///   - Vertices of large bulk are generated in parallel, each worker writing at the fixed offset of its quads
+    /// - Parameter quads: Structure of arrays of quads
+    static void DrawQuads(const Quads2D& quads);
+
+    /// This function draws rounded rectangle with color. Corners are rounded only with Unified vertex format, else a plain quad is drawn
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Rectangle
+    ///   - color: Color of Rectangle
+    ///   - corner_radius: radius of corners in world units
+    ///   - fade: fade of rectangle edge in world units
+    ///   - object_id: Pixel ID of Rectangle
+    static void DrawRoundedQuad(const glm::mat4& transform, const glm::vec4& color, float corner_radius, float fade = (float)0.005,
+                                int32_t object_id = -1);
 
     /// This function draws circle with color
     /// - Parameters:
@@ -103,7 +177,7 @@ namespace ikan {
     ///   - thickness: thickneess of Circle
     ///   - fade: fade of Circle Edge
     ///   - object_id: Pixel ID of Circle
-    static void DrawCircle(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, const glm::vec4& tint_color = glm::vec4(1.0f),
+    static void DrawCircle(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color = glm::vec4(1.0f),
                            float tiling_factor = 1.0f, float thickness = 1.0f, float fade = (float)0.005, int32_t object_id = -1 );
     
     /// This function draws a line using two points in 3d Space
@@ -137,10 +211,21 @@ namespace ikan {
     static void NextBatch();
     /// This function flsh a single batch
     static void Flush();
+    /// This function renders the pending quads (and unified shapes) only. Used when quad batch overflows, so that pending circles
+    /// and lines are not drawn twice
+    static void FlushQuadBatch();
+    /// This function renders the pending circles only. Used when circle batch overflows
+    static void FlushCircleBatch();
+    /// This function renders the pending lines only. Used when line batch overflows
+    static void FlushLineBatch();
 
     // ---------------------------------------------------
     // Internal Helper API for Rendering Quad and Circle
     // ---------------------------------------------------
+    /// This function returns the slot of texture in current quad batch. Loads the texture in new slot if not loaded already
+    /// (starts new batch if all slots are used). Returns 0 (white texture) for nullptr
+    /// - Parameter texture: texture to be binded in quad
+    static uint32_t GetQuadTextureSlot(const Texture* texture);
     /// This function is the helper function to rendere the quad
     /// - Parameters:
     ///   - transform: transform matrix of quad
@@ -149,7 +234,7 @@ namespace ikan {
     ///   - tiling_factor: tiling factor of texture
     ///   - tint_color: color of quad
     ///   - object_id: object/pixel id
-    static void DrawTextureQuad(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, const glm::vec2* texture_coords,
+    static void DrawTextureQuad(const glm::mat4& transform, const Texture* texture, const glm::vec2* texture_coords,
                                 float tiling_factor, const glm::vec4& tint_color, int32_t object_id);
     
     /// This function is the helper function to rendere the circle
@@ -161,8 +246,20 @@ namespace ikan {
     ///   - thickness: thickness of circle
     ///   - fade: cirlce face
     ///   - object_id: object/pixel id
-    static void DrawTextureCircle(const glm::mat4& transform, const std::shared_ptr<Texture>& texture, float tiling_factor,
+    static void DrawTextureCircle(const glm::mat4& transform, const Texture* texture, float tiling_factor,
                                   const glm::vec4& tint_color, float thickness, float fade, int32_t object_id);
+    /// This function is the helper function to render any shape in the Unified quad batch
+    /// - Parameters:
+    ///   - kind: kind of shape
+    ///   - transform: transform matrix of shape
+    ///   - texture: texture to be binded in shape
+    ///   - tiling_factor: tiling factor of texture
+    ///   - tint_color: color of shape
+    ///   - param: thickness of circle or corner radius of rounded rect
+    ///   - fade: fade of shape edge
+    ///   - object_id: object/pixel id
+    static void DrawShape(ShapeKind kind, const glm::mat4& transform, const Texture* texture, float tiling_factor,
+                          const glm::vec4& tint_color, float param, float fade, int32_t object_id);
 
   };
   
@@ -0,0 +1,110 @@
+//
+//  render_queue_2d.hpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "renderer/graphics/texture.hpp"
+#include "renderer/graphics/sprite_sheet.hpp"
+
+namespace ikan {
+
+  class TextureAtlas;
+
+  /// This class collects all the 2D sprites of a frame, sort them using a 64 bit key and then submit them to Batch2DRenderer.
+  ///   - Key is packed as | Layer (8) | Depth (32) | Shader (4) | Texture (20) |
+  ///   - Keys are sorted with stable LSD radix sort, so sprites with same key keep their submission order
+  ///   - If texture atlas is given, textures of quads (not tiled) are replaced by their atlas page, so that they share the batches
+  ///   - Note: To be used between Batch2DRenderer::BeginBatch() and Batch2DRenderer::EndBatch()
+  class RenderQueue2D {
+  public:
+    /// This function clears all the sprites submitted in previous frame
+    /// - Parameter texture_atlas: atlas to remap the quad textures in this frame (optional)
+    static void Begin(const TextureAtlas* texture_atlas = nullptr);
+    /// This function sorts all the submitted sprites and emits them to Batch2DRenderer
+    static void End();
+
+    /// This function submits Quad with color
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Quad
+    ///   - color: Color of Quad
+    ///   - object_id: Pixel ID of Quad
+    ///   - layer: sorting layer of Quad
+    static void SubmitQuad(const glm::mat4& transform, const glm::vec4& color, int32_t object_id = -1, uint8_t layer = 0);
+    /// This function submits Quad with texture
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Quad
+    ///   - texture: Texture of Quad
+    ///   - tint_color: Color of Quad
+    ///   - tiling_factor: tiling factor of Texture
+    ///   - object_id: Pixel ID of Quad
+    ///   - layer: sorting layer of Quad
+    static void SubmitQuad(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color,
+                           float tiling_factor, int32_t object_id = -1, uint8_t layer = 0);
+    /// This function submits Quad with Subtexture sprite
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Quad
+    ///   - sub_texture: Subtexture of Quad
+    ///   - tint_color: Color of Quad
+    ///   - object_id: Pixel ID of Quad
+    ///   - layer: sorting layer of Quad
+    static void SubmitQuad(const glm::mat4& transform, const std::shared_ptr<SubTexture>& sub_texture, const glm::vec4& tint_color,
+                           int32_t object_id = -1, uint8_t layer = 0);
+    /// This function submits Quad with frame of sprite sheet
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Quad
+    ///   - sprite_sheet: sprite sheet
+    ///   - frame: frame ID in sprite sheet
+    ///   - tint_color: Color of Quad
+    ///   - object_id: Pixel ID of Quad
+    ///   - layer: sorting layer of Quad
+    static void SubmitQuad(const glm::mat4& transform, const SpriteSheet& sprite_sheet, SpriteSheet::FrameID frame,
+                           const glm::vec4& tint_color, int32_t object_id = -1, uint8_t layer = 0);
+    /// This function submits circle with color or texture
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Circle
+    ///   - texture: Texture of Circle (null handle for only color)
+    ///   - tint_color: Color of Circle
+    ///   - tiling_factor: tiling factor of Texture
+    ///   - thickness: thickneess of Circle
+    ///   - fade: fade of Circle Edge
+    ///   - object_id: Pixel ID of Circle
+    ///   - layer: sorting layer of Circle
+    static void SubmitCircle(const glm::mat4& transform, TextureHandle texture, const glm::vec4& tint_color,
+                             float tiling_factor, float thickness, float fade, int32_t object_id = -1, uint8_t layer = 0);
+
+    /// This function returns the number of sprites submitted in current queue
+    static uint32_t Size();
+
+    MAKE_PURE_STATIC(RenderQueue2D);
+
+  private:
+    /// This function submits Quad with final texture and its texture coordinates
+    /// - Parameters:
+    ///   - transform: Transformation matrix of Quad
+    ///   - texture: Texture of Quad
+    ///   - uv_rect: texture coordinates (min u, min v, max u, max v)
+    ///   - tint_color: Color of Quad
+    ///   - object_id: Pixel ID of Quad
+    ///   - layer: sorting layer of Quad
+    static void SubmitQuadImpl(const glm::mat4& transform, TextureHandle texture, const glm::vec4& uv_rect,
+                               const glm::vec4& tint_color, int32_t object_id, uint8_t layer);
+    /// This function returns the sort key of a sprite
+    /// - Parameters:
+    ///   - layer: sorting layer
+    ///   - depth: z position of sprite
+    ///   - shader: shader (shape) of sprite
+    ///   - texture: renderer ID of sprite texture
+    static uint64_t MakeKey(uint8_t layer, float depth, uint8_t shader, uint32_t texture);
+    /// This function sorts the sort keys with LSD radix sort
+    static void RadixSort();
+    /// This function returns the number of batches, Batch2DRenderer would take to render sprites in the order of indices. Called only
+    /// while Renderer 2D Stats widget is visible
+    /// - Parameter sorted: use sorted order, else submission order
+    static uint32_t EstimateBatches(bool sorted);
+  };
+
+} // namespace ikan
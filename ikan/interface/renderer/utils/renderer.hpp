@@ -107,6 +107,8 @@ namespace ikan {
     ///   - width: new width of renderer viewport
     ///   - height: new height of renderer viewport
     static void SetViewport(uint32_t width, uint32_t height);
+    /// This function returns the current renderer viewport size
+    static const glm::uvec2& GetViewportSize();
     
     /// This function returns the the Pixel ID from Viewport
     /// - Parameters:
@@ -136,6 +138,27 @@ namespace ikan {
     ///   - path: path of textre
     ///   - linear: min linear flag
     [[nodiscard]] static std::shared_ptr<Texture> GetTexture(const std::string& path, bool linear = true);
+    /// This function returns the texture pointer from the library without blocking. If not present then returns placeholder texture
+    /// till the image is decoded (on worker thread) and uploaded (in UpdateTextureLibrary)
+    /// - Parameters:
+    ///   - path: path of textre
+    ///   - linear: min linear flag
+    [[nodiscard]] static std::shared_ptr<Texture> GetTextureAsync(const std::string& path, bool linear = true);
+    /// This function decodes the textures in parallel and uploads them in order, storing in the library
+    /// - Parameter textures: path and min linear flag of each texture
+    static void PreloadTextures(const std::vector<std::pair<std::string, bool>>& textures);
+    /// This function uploads the textures decoded asynchronously and evicts unused textures over budget. Called each frame by
+    /// application
+    static void UpdateTextureLibrary();
+    /// This function updates the capacity of 2D batches from the flushes of previous frame. Called each frame by application
+    static void UpdateBatchCapacity();
+    /// This function sets the budget of texture library. Least recently used textures not referenced outside library are evicted
+    /// when resident size exceeds it
+    /// - Parameter bytes: budget in bytes
+    static void SetTextureBudget(size_t bytes);
+    /// This function shows the textures resident in library in gui widget
+    /// - Parameter is_open: flag to show or hide the widget
+    static void RenderTextureLibraryGui(bool *is_open = nullptr);
 
     /// This API draws a quad with pipeline and indexed count
     /// - Parameters:
@@ -152,6 +175,12 @@ namespace ikan {
     ///   - pipeline: pipeline having vertex buffer and index buffer
     ///   - count: number of Indices (if 0 then use index buffer of Vertex array)
     static void DrawArrays(const std::shared_ptr<Pipeline>& pipeline, uint32_t count);
+    /// This API draws multiple instances of indexed pipeline
+    /// - Parameters:
+    ///   - pipeline: pipeline having vertex buffers (per vertex and per instance) and index buffer
+    ///   - count: number of Indices of single instance
+    ///   - instance_count: number of instances
+    static void DrawIndexedInstanced(const std::shared_ptr<Pipeline>& pipeline, uint32_t count, uint32_t instance_count);
 
     MAKE_PURE_STATIC(Renderer);
   };
@@ -83,6 +83,12 @@ namespace ikan {
     ///   - pipeline: pipeline having vertex buffer and index buffer
     ///   - count: number of Indices (if 0 then use index buffer of Vertex array)
     virtual void DrawArrays(const std::shared_ptr<Pipeline>& pipeline, uint32_t count) const = 0;
+    /// This API draws multiple instances of indexed pipeline
+    /// - Parameters:
+    ///   - pipeline: pipeline having vertex buffers (per vertex and per instance) and index buffer
+    ///   - count: number of Indices of single instance
+    ///   - instance_count: number of instances
+    virtual void DrawIndexedInstanced(const std::shared_ptr<Pipeline>& pipeline, uint32_t count, uint32_t instance_count) const = 0;
   };
   
 } // namespace ikan
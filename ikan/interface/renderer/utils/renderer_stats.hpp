@@ -15,6 +15,15 @@ namespace ikan {
     struct Renderer2DStats {
       uint32_t max_quads = 0, max_circles = 0, max_lines = 0;
       uint32_t quads = 0, circles = 0, lines = 0;
+      uint32_t batches_unsorted = 0, batches_sorted = 0;
+      uint32_t quad_instances = 0, instanced_draw_calls = 0;
+      uint32_t static_quads = 0, static_chunk_uploads = 0;
+      uint32_t sprites_submitted = 0, sprites_culled = 0;
+      /// Flag to estimate the batches before and after sorting the render queue. Set each frame only if widget was visible in last
+      /// frame, as estimation simulates the batching of all the sprites twice
+      bool estimate_batches = false;
+      /// Flag set by RenderGui if widget is visible in this frame
+      bool widget_visible = false;
       
       /// This function shows the stats in gui widget
       /// - Parameter is_open: flag to show or hide the widget
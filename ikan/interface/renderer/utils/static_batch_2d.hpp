@@ -0,0 +1,138 @@
+//
+//  static_batch_2d.hpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include "renderer/graphics/shader.hpp"
+#include "renderer/graphics/texture.hpp"
+
+namespace ikan {
+
+  class Pipeline;
+  class VertexBuffer;
+  class IndexBuffer;
+
+  /// This class retains the vertices of static quads in GPU chunks, so that they are not rebuilt and uploaded each frame.
+  ///   - Each quad is stored with a key (e.g. entity). Owner submits the quad again only when it is modified
+  ///   - Only the chunks having a changed quad are uploaded again
+  ///   - Owner removes the quad explicitly when it is destroyed or not static anymore
+  ///   - Chunks are rendered in Render() before the sorted streaming quads, so owner should store only opaque (or alpha tested) quads,
+  ///     whose order is resolved by depth test
+  ///   - Chunks outside the camera view are culled with the bounds of chunk
+  class StaticBatch2D {
+  public:
+    /// This constructor creates the static batch
+    /// - Parameter max_quads_per_chunk: max quads to be stored in single chunk (single draw call)
+    StaticBatch2D(uint32_t max_quads_per_chunk = 1000);
+    /// This destructor destroys all the chunks
+    ~StaticBatch2D();
+
+    /// This function uploads the changed chunks and renders the chunks inside camera view
+    /// - Parameters:
+    ///   - cam_view_proj_mat: Camera View projection Matrix
+    ///   - view_bounds: world space bounds of camera view (min x, min y, max x, max y). nullptr to render all chunks
+    /// - Returns: number of quads rendered
+    uint32_t Render(const glm::mat4& cam_view_proj_mat, const glm::vec4* view_bounds = nullptr);
+
+    /// This function adds or replaces the quad in the cache
+    /// - Parameters:
+    ///   - key: unique key of quad
+    ///   - transform: Transformation matrix of Quad
+    ///   - texture: Texture of Quad (null handle for only color)
+    ///   - texture_coords: texture coordinates of 4 vertices
+    ///   - tiling_factor: tiling factor of Texture
+    ///   - tint_color: Color of Quad
+    ///   - object_id: Pixel ID of Quad
+    void SubmitQuad(uint64_t key, const glm::mat4& transform, TextureHandle texture, const glm::vec2* texture_coords,
+                    float tiling_factor, const glm::vec4& tint_color, int32_t object_id);
+    /// This function removes the quad from the cache, if cached
+    /// - Parameter key: unique key of quad
+    void RemoveQuad(uint64_t key);
+    /// This function clears all the cached quads
+    void Clear();
+
+    /// This function returns the number of cached quads
+    uint32_t GetNumQuads() const { return (uint32_t)entries_.size(); }
+    /// This function returns the number of chunks
+    uint32_t GetNumChunks() const { return (uint32_t)chunks_.size(); }
+
+    DELETE_COPY_MOVE_CONSTRUCTORS(StaticBatch2D);
+
+  private:
+    // Constants
+    static constexpr uint32_t VertexForSingleQuad = 4;
+    static constexpr uint32_t IndicesForSingleQuad = 6;
+
+    /// Single vertex of a static quad. Same as Batch2DRenderer full vertex
+    struct Vertex {
+      glm::vec3 position;
+      glm::vec4 color;
+      glm::vec2 texture_coords;
+      float texture_index;
+      float tiling_factor;
+      int32_t pixel_id;
+    };
+
+    /// Retained GPU chunk of static quads
+    struct Chunk {
+      std::shared_ptr<Pipeline> pipeline;
+      std::shared_ptr<VertexBuffer> vertex_buffer;
+
+      std::vector<Vertex> vertices;
+      /// Key of each quad stored in chunk
+      std::vector<uint64_t> keys;
+
+      std::array<TextureHandle, MaxTextureSlotsInShader> textures;
+      /// Number of quads using each texture slot. Slot is reused for other texture once no quad uses it
+      std::array<uint32_t, MaxTextureSlotsInShader> texture_refs{};
+      uint32_t num_textures = 1; // 0 = white texture
+
+      /// World space bounds of vertices (min x, min y, max x, max y). Updated with upload
+      glm::vec4 bounds = glm::vec4(0.0f);
+      /// Flag to upload the vertices again
+      bool dirty = true;
+    };
+
+    /// Location of a cached quad
+    struct Entry {
+      uint32_t chunk = 0;
+      uint32_t slot = 0;
+      uint32_t texture_slot = 0;
+    };
+
+    // Member functions
+    /// This function returns the texture slot in chunk. Slot not used by any quad is reused for new texture. Returns -1 if texture
+    /// can not be loaded in chunk. NOTE: Reference of slot is not added
+    /// - Parameters:
+    ///   - chunk: chunk
+    ///   - texture: texture (null handle for white)
+    int32_t GetTextureSlot(Chunk& chunk, TextureHandle texture);
+    /// This function returns the index of chunk having space for a quad with texture. Creates new chunk if needed
+    /// - Parameter texture: texture of quad
+    uint32_t GetFreeChunk(TextureHandle texture);
+    /// This function removes the reference of a quad from texture slot. Slot is freed when no quad uses it
+    /// - Parameters:
+    ///   - chunk: chunk
+    ///   - texture_slot: texture slot of quad
+    void ReleaseTextureSlot(Chunk& chunk, uint32_t texture_slot);
+    /// This function removes the quad from its chunk
+    /// - Parameter entry: entry of quad
+    void RemoveFromChunk(const Entry& entry);
+
+    // Member variables
+    uint32_t max_quads_per_chunk_ = 0;
+
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    std::unordered_map<uint64_t, Entry> entries_;
+
+    std::shared_ptr<IndexBuffer> index_buffer_;
+    std::shared_ptr<Shader> shader_;
+    std::shared_ptr<Texture> white_texture_;
+    glm::vec4 vertex_base_position_[4];
+  };
+
+} // namespace ikan
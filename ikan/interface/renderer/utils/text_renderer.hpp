@@ -24,6 +24,9 @@ namespace ikan {
     /// - Parameter font_file_path: path of font
     /// - Note: Load the Font before using any other API In client
     static void LoadFreetype(const std::string& font_file_path);
+    /// This function sets the memory budget of glyph atlas pages. Least recently used page is evicted when budget is full
+    /// - Parameter budget: budget in bytes (at least one page, at most one page per texture slot of shader)
+    static void SetGlyphCacheBudget(size_t budget);
 
     /// This function begins the Batch for 2D Rendere (to be called each frame)
     /// - Parameter cam_view_proj_mat: Camera View projection Matrix
@@ -33,18 +36,18 @@ namespace ikan {
 
     /// This functions renders the Text in Window using postition and sclae
     /// - Parameters:
-    ///   - text: Text to be rendereed
+    ///   - text: Text to be rendereed (UTF-8)
     ///   - position: Text Poistion
     ///   - scale: Text Poistion
     ///   - color: Color of text
-    static void RenderFixedViewText(std::string text, glm::vec3 position, const glm::vec2& scale, const glm::vec4& color);
+    static void RenderFixedViewText(const std::string& text, const glm::vec3& position, const glm::vec2& scale, const glm::vec4& color);
     /// This functions renders the Text in Window using postition and sclae
     /// - Parameters:
-    ///   - text: Text to be rendereed
+    ///   - text: Text to be rendereed (UTF-8)
     ///   - position: Text Poistion
     ///   - scale: Text Poistion
     ///   - color: Color of text
-    static void RenderText(std::string text, glm::vec3 position, const glm::vec2& scale, const glm::vec4& color);
+    static void RenderText(const std::string& text, const glm::vec3& position, const glm::vec2& scale, const glm::vec4& color);
 
     MAKE_PURE_STATIC(TextRenderer);
     
@@ -54,13 +57,15 @@ namespace ikan {
     /// This function moves to next batch in single frame
     static void NextBatch();
 
-    /// This functions renders the Text in Window using postition and sclae
+    /// This functions renders the Text in Window using postition and sclae. Glyph quads of text are built once and cached (keyed by
+    /// text and size bucket), so each call only applies the position, scale and color. Glyphs not in cache are rasterized on worker
+    /// thread and used from next batch
     /// - Parameters:
     ///   - text: Text to be rendereed
     ///   - position: Text Poistion
     ///   - scale: Text Poistion
     ///   - color: Color of text
-    static void RenderTextImpl(std::string text, glm::vec3 position, const glm::vec2& scale, const glm::vec4& color);
+    static void RenderTextImpl(const std::string& text, const glm::vec3& position, const glm::vec2& scale, const glm::vec4& color);
   };
   
 } // namespace ikan
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "renderer/graphics/texture.hpp"
+#include "renderer/graphics/sprite_sheet.hpp"
 
 namespace ikan {
   
@@ -15,7 +16,7 @@ namespace ikan {
   struct TextureComponent {
     bool use = false;
     float tiling_factor = 1.0f;
-    std::vector<std::shared_ptr<Texture>> texture;
+    std::vector<TextureHandle> texture;
     
     // Animation Sprite Data
     int32_t speed = 15;
@@ -24,7 +25,7 @@ namespace ikan {
     void ClearTextures() { texture.clear(); }
 
     TextureComponent(const std::shared_ptr<Texture>& tex = nullptr, bool use = true);
-    DEFINE_COPY_MOVE_CONSTRUCTORS(TextureComponent)
+    DEFAULT_COPY_MOVE_CONSTRUCTORS(TextureComponent)
     
     template<typename UIFunction>
     /// This function renders the texture components
@@ -55,10 +56,10 @@ namespace ikan {
     ///   - texture: texture referrence
     ///   - is_animation: is texture anumated (already have multiple texture)
     ///   - deleted_texture: deleted texture reference
-    bool LoadTextureIcon(std::shared_ptr<Texture>& texture, bool* is_animation, std::shared_ptr<Texture>& deleted_texture);
+    bool LoadTextureIcon(TextureHandle& texture, bool* is_animation, TextureHandle& deleted_texture);
     /// This wraps the Load texture vector in component
     /// - Parameter texture_vector: tecture vector
-    bool LoadTextureIconWrapper(std::vector<std::shared_ptr<Texture>>& texture_vector);
+    bool LoadTextureIconWrapper(std::vector<TextureHandle>& texture_vector);
   };
   
   /// This structure holds the property of sprite component (Sub Texture)
@@ -70,9 +71,26 @@ namespace ikan {
     
     std::vector<std::shared_ptr<SubTexture>> sprite_images;
     
+    /// Sprite sheet and its animation clip. If sheet is set, sub texture sprite is rendered from the frames of clip instead of
+    /// sprite_images (Runtime only, not saved in scene)
+    std::shared_ptr<SpriteSheet> sprite_sheet;
+    SpriteSheet::ClipID sprite_clip = 0;
+    
     void ClearSprites() { sprite_images.clear(); }
+    /// This function sets the sprite sheet clip of sprite
+    /// - Parameters:
+    ///   - sheet: sprite sheet
+    ///   - clip: animation clip in sheet
+    void SetSpriteClip(const std::shared_ptr<SpriteSheet>& sheet, SpriteSheet::ClipID clip) {
+      sprite_sheet = sheet;
+      sprite_clip = clip;
+    }
     void ResetAnimIndx() {
-      if (use_sub_texture) {
+      if (use_sub_texture and sprite_sheet) {
+        if (anim_idx >= speed * sprite_sheet->GetClip(sprite_clip).num_frames or anim_idx < 1)
+          anim_idx = 0;
+      }
+      else if (use_sub_texture) {
         if (anim_idx >= speed * sprite_images.size() or anim_idx < 1)
           anim_idx = 0;
       }
@@ -87,15 +105,15 @@ namespace ikan {
     DEFINE_COPY_MOVE_CONSTRUCTORS(SpriteComponent)
     
     template<typename UIFunction>
-    /// This function renders the texture components
+    /// This function renders the texture components. Returns true if any property of sprite is changed
     /// - Parameters:
     ///   - color: color of the texture
-    ///   - ui_function: function to render below texture Use
-    void RenderGui(glm::vec4& color, UIFunction ui_function) {
+    ///   - ui_function: function to render below texture Use. Returns true if it changes any value
+    bool RenderGui(glm::vec4& color, UIFunction ui_function) {
       // Quad Color
       ImGui::Columns(2);
       ImGui::SetColumnWidth(0, ImGui::GetWindowContentRegionMax().x / 2);
-      ui_function();
+      bool changed = ui_function();
       
       ImGui::NextColumn();
       ImGui::Text("Quad Color");
@@ -104,18 +122,19 @@ namespace ikan {
       ImGui::Separator();
       
       // Render All texture Component Data
-      RenderGuiWork();
+      changed |= RenderGuiWork();
+      return changed;
     }
     
   private:
-    /// This function renders the GUI data Other then Function UI
-    void RenderGuiWork();
-    /// This function loads the textrue and sprite again
+    /// This function renders the GUI data Other then Function UI. Returns true if any property of sprite is changed
+    bool RenderGuiWork();
+    /// This function copies the texture handles and shares the sprites
     /// - Parameters:
     ///   - textures: Texture vecote
-    ///   - linear_edge: linear edge filter
-    void LoadSprite(const std::vector<std::shared_ptr<Texture>>& textures,
-                    const std::vector<std::shared_ptr<SubTexture>>& sprites, bool linear_edge);
+    ///   - sprites: sprites
+    void LoadSprite(const std::vector<TextureHandle>& textures,
+                    const std::vector<std::shared_ptr<SubTexture>>& sprites);
     /// This function changes the linear flag of texture
     void ChangeLinearTexture();
 
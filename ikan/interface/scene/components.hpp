@@ -21,7 +21,8 @@ namespace ikan {
     case Axis::Z: param.z = value; break; \
     default: IK_ASSERT(false) \
   } \
-  transform = Math::GetTransformMatrix(position, rotation, scale);
+  transform = Math::GetTransformMatrix(position, rotation, scale); \
+  Modified();
 
   
 #define ADD_TRANSFORM(param) \
@@ -31,10 +32,29 @@ namespace ikan {
     case Axis::Z: param.z += value; break; \
     default: IK_ASSERT(false) \
   } \
-  transform = Math::GetTransformMatrix(position, rotation, scale);
+  transform = Math::GetTransformMatrix(position, rotation, scale); \
+  Modified();
 
   class Entity;
   
+  /// This structure notifies the owner scene about the change of a component, so that the scene processes only the modified entities
+  /// (e.g. static quads) instead of checking all of them each frame
+  ///   - Hook is attached by the scene (on construction of component). Detached component ignores the notification
+  ///   - Entity is added to the modified list only once till the scene resets the pending flag
+  struct ComponentChangeHook {
+    std::vector<entt::entity>* modified_entities = nullptr;
+    entt::entity entity = entt::null;
+    bool pending = false;
+    
+    /// This function adds the entity in modified list of scene, if not added already
+    void Notify() {
+      if (modified_entities and !pending) {
+        pending = true;
+        modified_entities->push_back(entity);
+      }
+    }
+  };
+  
   struct IDComponent {
     UUID id = 0;
     void Copy(const IDComponent& other);
@@ -53,6 +73,9 @@ namespace ikan {
   
   struct TransformComponent {
     bool is_isometric = false;
+    /// Notifies the scene when transform of a static quad changes
+    ComponentChangeHook change_hook;
+
     const glm::mat4& Transform() const { return transform; }
     const glm::vec3& Position() const { return position; }
     const glm::vec3& Rotation() const { return rotation; }
@@ -63,9 +86,9 @@ namespace ikan {
     void UpdateRotation(Axis axis, float value) { UPDATE_TRANSFORM(rotation) }
     void UpdateScale(Axis axis, float value) { UPDATE_TRANSFORM(scale) }
 
-    void UpdatePosition(const glm::vec3& value) { position = value; transform = Math::GetTransformMatrix(position, rotation, scale); }
-    void UpdateRotation(const glm::vec3& value) { rotation = value; transform = Math::GetTransformMatrix(position, rotation, scale); }
-    void UpdateScale(const glm::vec3& value) { scale = value; transform = Math::GetTransformMatrix(position, rotation, scale); }
+    void UpdatePosition(const glm::vec3& value) { position = value; transform = Math::GetTransformMatrix(position, rotation, scale); Modified(); }
+    void UpdateRotation(const glm::vec3& value) { rotation = value; transform = Math::GetTransformMatrix(position, rotation, scale); Modified(); }
+    void UpdateScale(const glm::vec3& value) { scale = value; transform = Math::GetTransformMatrix(position, rotation, scale); Modified(); }
 
     void AddPosition(Axis axis, float value) { ADD_TRANSFORM(position) }
     void AddRotation(Axis axis, float value) { ADD_TRANSFORM(rotation) }
@@ -78,6 +101,9 @@ namespace ikan {
     DEFINE_COPY_MOVE_CONSTRUCTORS(TransformComponent);
 
   private:
+    /// This function notifies the scene that transform matrix is changed
+    void Modified() { change_hook.Notify(); }
+    
     glm::quat quaternion;
     glm::mat4 transform;
     glm::vec3 position{0.0f}, rotation{0.0f}, scale{1.0f};
@@ -95,9 +121,21 @@ namespace ikan {
     DEFINE_COPY_MOVE_CONSTRUCTORS(CameraComponent);
   };
 
+  /// Quad data is edited in place. NOTE: Call MarkModified() after changing sprite, color or static flag of a quad outside the
+  /// RenderGui() and Copy(), else static quad keeps rendering its old data from the retained chunk
   struct QuadComponent {
+    /// Sprite of quad. Call MarkModified() after changing it
     SpriteComponent sprite;
+    /// Color of quad. Call MarkModified() after changing it
     glm::vec4 color{1.0f};
+    /// Static quads are rendered from retained batch chunks, which are rebuilt only when transform or quad changes. Only opaque
+    /// quads (color alpha 1) are static, translucent quads are rendered in sorted order each frame
+    bool is_static = false;
+    /// Notifies the scene when quad data changes
+    ComponentChangeHook change_hook;
+    
+    /// This function notifies the scene that quad data is modified, so that static quad is rebuilt (or moved to dynamic quads)
+    void MarkModified() { change_hook.Notify(); }
     
     void Copy(const QuadComponent& other);
     void RenderGui();
@@ -0,0 +1,127 @@
+//
+//  entity_table.hpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <entt.hpp>
+#include <optional>
+
+namespace ikan {
+
+  /// This class stores the entities of scene in a dense table addressed by entity number (index bits of entt handle).
+  ///   - Lookup is O(1): page and slot are computed from entity number, then stored handle (with version) is compared, so handle of
+  ///     destroyed entity never returns the new entity reusing its slot
+  ///   - Entities are stored in fixed size pages that never move, so address of stored entity is stable until it is erased
+  ///   - Entities are iterated in the order of entity number (deterministic, unlike hash order)
+  ///   - Note: EntityType should be convertible to entt::entity. Slots are constructed only when entity is inserted
+  template<typename EntityType>
+  class EntityTable {
+  public:
+    static constexpr uint32_t PageBits = 10;
+    static constexpr uint32_t PageSize = 1u << PageBits;
+    static constexpr uint32_t PageMask = PageSize - 1;
+
+    EntityTable() = default;
+    DELETE_COPY_MOVE_CONSTRUCTORS(EntityTable);
+
+    /// This function stores the entity at slot of its handle and returns the stored entity
+    /// - Parameter entity: entity to be stored
+    EntityType& Insert(const EntityType& entity) {
+      const entt::entity handle = entity;
+      IK_ASSERT(handle != entt::null, "Invalid entity handle");
+
+      const uint32_t index = (uint32_t)entt::registry::entity(handle);
+      const uint32_t page_idx = index >> PageBits;
+      if (page_idx >= pages_.size())
+        pages_.resize(page_idx + 1);
+      if (!pages_[page_idx])
+        pages_[page_idx] = std::make_unique<Page>();
+
+      Page& page = *pages_[page_idx];
+      std::optional<EntityType>& slot = page.entities[index & PageMask];
+      IK_ASSERT(!slot.has_value(), "Entity Already Added");
+
+      slot.emplace(entity);
+      ++page.num_entities;
+      ++size_;
+      return *slot;
+    }
+
+    /// This function removes the entity from table. Ignores if entity is not present
+    /// - Parameter handle: handle of entity
+    void Erase(entt::entity handle) {
+      if (!Find(handle))
+        return;
+
+      const uint32_t index = (uint32_t)entt::registry::entity(handle);
+      Page& page = *pages_[index >> PageBits];
+      page.entities[index & PageMask].reset();
+      --page.num_entities;
+      --size_;
+    }
+
+    /// This function returns the stored entity of handle. Returns nullptr if not present (or handle is of destroyed entity)
+    /// - Parameter handle: handle of entity
+    EntityType* Find(entt::entity handle) const {
+      if (handle == entt::null)
+        return nullptr;
+
+      const uint32_t index = (uint32_t)entt::registry::entity(handle);
+      const uint32_t page_idx = index >> PageBits;
+      if (page_idx >= pages_.size() or !pages_[page_idx])
+        return nullptr;
+
+      std::optional<EntityType>& slot = pages_[page_idx]->entities[index & PageMask];
+      return (slot.has_value() and static_cast<entt::entity>(*slot) == handle) ? &(*slot) : nullptr;
+    }
+
+    /// This function returns the stored entity of handle. Asserts if not present
+    /// - Parameter handle: handle of entity
+    EntityType& At(entt::entity handle) const {
+      EntityType* entity = Find(handle);
+      IK_ASSERT(entity, "Entity is not present in table");
+      return *entity;
+    }
+
+    /// This function returns true if entity of handle is present
+    /// - Parameter handle: handle of entity
+    bool Contains(entt::entity handle) const { return Find(handle) != nullptr; }
+    /// This function returns the number of entities stored
+    uint32_t Size() const { return size_; }
+
+    /// This function removes all the entities and frees the pages
+    void Clear() {
+      pages_.clear();
+      size_ = 0;
+    }
+
+    template<typename Function>
+    /// This function calls the function for each stored entity in the order of entity number
+    /// - Parameter function: function taking entity reference
+    void Each(Function function) const {
+      for (const auto& page : pages_) {
+        if (!page or page->num_entities == 0)
+          continue;
+
+        for (auto& entity : page->entities) {
+          if (entity.has_value())
+            function(*entity);
+        }
+      }
+    }
+
+  private:
+    struct Page {
+      std::array<std::optional<EntityType>, PageSize> entities;
+      uint32_t num_entities = 0;
+    };
+
+    std::vector<std::unique_ptr<Page>> pages_;
+    uint32_t size_ = 0;
+  };
+
+} // namespace ikan
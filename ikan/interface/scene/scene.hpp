@@ -9,6 +9,7 @@
 
 #include <entt.hpp>
 #include <box2d/b2_world.h>
+#include <span>
 
 #include "physics/contact_listener.hpp"
 #include "physics/ray_cast.hpp"
@@ -17,15 +18,20 @@
 #include "core/events/event.h"
 #include "camera/editor_camera.hpp"
 #include "camera/scene_camera.hpp"
+#include "renderer/graphics/texture_atlas.hpp"
+#include "scene/entity_table.hpp"
+#include "scene/uuid_map.hpp"
 
 namespace ikan {
   
   class Entity;
   struct TransformComponent;
+  struct QuadComponent;
   struct Box2DColliderComponent;
   struct CircleColliiderComponent;
   struct RigidBodyComponent;
   struct PillBoxColliderComponent;
+  class StaticBatch2D;
 
   struct SceneCameraData {
     SceneCamera* scene_camera = nullptr;
@@ -66,12 +72,35 @@ namespace ikan {
     ///   - name: name of entity
     ///   - uuid: Unique ID of entity
     [[nodiscard]] Entity& CreateEntity(const std::string& name = "Unknown Entity", UUID uuid = UUID());
-    /// This function destory the entity from scene registry
+    /// This function destory the entity from scene registry.
+    ///   - In play mode entity is only queued and destroyed at the end of frame update (after scripts and physics)
     /// - Parameter entity: entity to be destroyed
     void DestroyEntity(Entity entity);
     /// This function duplicate the entity and copy all the components
     /// - Parameter entity: entity to be destroyed
     [[nodiscard]] Entity& DuplicateEntity(Entity entity);
+    
+    /// This function creates the entities in one batch with new UUIDs. Each entity has the Tag and Transform component.
+    ///   - Registry storage is reserved once for all entities and components are added pool by pool
+    /// - Parameters:
+    ///   - count: number of entities to be created
+    ///   - name: name of entities
+    std::vector<Entity*> CreateEntities(uint32_t count, const std::string& name = "Unknown Entity");
+    /// This function creates the entities in one batch with new UUIDs. Each entity gets the copy of all the components of archetype
+    /// - Parameters:
+    ///   - count: number of entities to be created
+    ///   - archetype: entity whose components are copied to each new entity
+    std::vector<Entity*> CreateEntities(uint32_t count, const Entity& archetype);
+    /// This function duplicates the entities in one batch with new UUIDs. Each new entity gets the copy of all the components of its
+    /// source entity. Components are copied pool by pool
+    /// - Parameter entities: handles of entities to be duplicated
+    std::vector<Entity*> DuplicateEntities(std::span<const entt::entity> entities);
+    /// This function destroys the entities in one batch. Scripts are destroyed first, then all physics bodies, and at last the
+    /// entities are removed from registry. Handles of entities already destroyed are ignored
+    ///   - In play mode entities are only queued and destroyed at the end of frame update (after scripts and physics), so scripts
+    ///     and contact callbacks can destroy any entity (including their own) safely
+    /// - Parameter entities: handles of entities to be destroyed
+    void DestroyEntities(std::span<const entt::entity> entities);
 
     /// This function update the scene
     /// - Parameter ts: time step
@@ -100,6 +129,16 @@ namespace ikan {
     /// This function change the renderer type of scene
     /// - Parameter type: type of scene
     void SetType(Type type);
+    /// This function sets the texture atlas to render the quads of scene. Quad textures are remapped to atlas pages while rendering
+    /// (components are not modified)
+    /// - Parameter texture_atlas: texture atlas (nullptr to render with own textures)
+    void SetTextureAtlas(const std::shared_ptr<TextureAtlas>& texture_atlas);
+    /// This function packs all the textures of quads in scene in a texture atlas and sets it to the scene
+    /// - Parameter spec: specification of atlas
+    void BuildTextureAtlas(const TextureAtlas::Specification& spec = TextureAtlas::Specification());
+    /// This function returns the file paths of all the textures of quads (sprites and sprite sheets) with filter, to be packed in atlas
+    /// - Parameter linear: min linear filter of textures
+    std::vector<std::string> GetQuadTexturePaths(bool linear) const;
 
     /// This function adds the Rigid body to the physics worlds
     /// - Parameters:
@@ -113,6 +152,9 @@ namespace ikan {
     /// This function returns the entity Ref from its id
     /// - Parameter id: entity ID
     Entity* GetEnitityFromId(int32_t id);
+    /// This function returns the entity Ref from its UUID. Returns nullptr if no entity has this UUID
+    /// - Parameter uuid: UUID of entity
+    Entity* GetEntityFromUUID(UUID uuid);
     /// This function returns the state of scene
     State GetState() const { return state_; }
     /// This finction return is scene is in edit state
@@ -135,6 +177,8 @@ namespace ikan {
     uint32_t GetMaxEntityId() const { return max_entity_id_; }
     /// This function returns the flag of use editor camera
     bool IsEditorCameraEnabled() const { return setting_.use_editor_camera; }
+    /// This function returns the texture atlas of scene (nullptr if not set)
+    const std::shared_ptr<TextureAtlas>& GetTextureAtlas() const { return texture_atlas_; }
     /// This function returns the Pgysics 2D Gravity
     b2Vec2 Get2DWorldGravity() const { return physics_2d_world_->GetGravity(); }
 
@@ -221,6 +265,22 @@ namespace ikan {
     /// This function creates an unique entity with UUID
     /// - Parameter uuid: Unique ID of entity
     Entity CreateUniqueEntity(UUID uuid);
+    /// This function stores the created entity in entity table and UUID index of scene
+    /// - Parameters:
+    ///   - entity: handle of entity created in registry
+    ///   - uuid: Unique ID of entity
+    void RegisterEntity(entt::entity entity, UUID uuid);
+    /// This function grows the registry capacity (at least double) if new entities can not be stored in current capacity
+    /// - Parameter num_new_entities: number of entities to be created
+    void ReserveEntities(uint32_t num_new_entities);
+    /// This function creates the entities in registry with IDComponent (new UUID) and stores them in scene
+    /// - Parameter count: number of entities to be created
+    std::vector<entt::entity> CreateUniqueEntities(uint32_t count);
+    /// This function destroys the entities now, without checking the state of scene
+    /// - Parameter entities: handles of entities to be destroyed
+    void DestroyEntitiesImmediate(std::span<const entt::entity> entities);
+    /// This function destroys all the entities queued for destruction in one batch
+    void FlushDestroyedEntities();
 
     /// This function updates the scene in edit mode
     /// - Parameter ts time step
@@ -242,8 +302,34 @@ namespace ikan {
     void RenderGuiRuntime();
 
     /// This function renders the 2D Entities
-    /// - Parameter came_view_proj_mat: camera view projection matrix
-    void Render2DEntities(const glm::mat4& came_view_proj_mat);
+    /// - Parameters:
+    ///   - came_view_proj_mat: camera view projection matrix
+    ///   - view_bounds: world space bounds of camera view (min x, min y, max x, max y). Sprites outside are culled. nullptr to render all
+    void Render2DEntities(const glm::mat4& came_view_proj_mat, const glm::vec4* view_bounds = nullptr);
+    /// This function rebuilds the static quads modified since last frame, and moves the quads between static batch and dynamic quads
+    void UpdateStaticQuads();
+    /// This function adds the quad in static batch
+    /// - Parameters:
+    ///   - entity: entity of quad
+    ///   - transform_comp: transform of quad
+    ///   - quad_comp: quad data
+    void SubmitStaticQuad(entt::entity entity, const TransformComponent& transform_comp, const QuadComponent& quad_comp);
+    
+    /// This function attaches the change hook to new or replaced quad and queues it for update
+    /// - Parameters:
+    ///   - registry: registry of scene
+    ///   - entity: entity of quad
+    void OnQuadChanged(entt::registry& registry, entt::entity entity);
+    /// This function queues the quad of entity for update when its transform is added or replaced
+    /// - Parameters:
+    ///   - registry: registry of scene
+    ///   - entity: entity of transform
+    void OnTransformChanged(entt::registry& registry, entt::entity entity);
+    /// This function removes the quad from static batch when its quad or transform is removed
+    /// - Parameters:
+    ///   - registry: registry of scene
+    ///   - entity: entity of removed component
+    void OnQuadRemoved(entt::registry& registry, entt::entity entity);
     /// This function renders the Texts
     /// - Parameter came_view_proj_mat: camera view projection matrix
     void RenderTexts(const glm::mat4& came_view_proj_mat);
@@ -264,10 +350,12 @@ namespace ikan {
     
     // EnTT data
     entt::registry registry_;
-    std::unordered_map<entt::entity, Entity> entity_id_map_;
+    EntityTable<Entity> entity_table_;
+    UUIDMap uuid_map_;
     uint32_t num_entities_ = 0;
     int32_t max_entity_id_ = -1;
     uint32_t curr_registry_capacity = 0;
+    std::vector<entt::entity> destroy_queue_; // Entities to be destroyed at the end of frame update in play mode
 
     // Scene Data
     State state_ = State::Edit;
@@ -282,6 +370,11 @@ namespace ikan {
     std::shared_ptr<b2World> physics_2d_world_;
     std::shared_ptr<b2ContactListener> contact_listner_2d_;
     std::shared_ptr<b2Draw> debug_draw_;
+    
+    // Renderer
+    std::shared_ptr<StaticBatch2D> static_batch_2d_;
+    std::vector<entt::entity> modified_quads_; // Quads (or their transforms) modified since last frame
+    std::shared_ptr<TextureAtlas> texture_atlas_;
 
     friend class SceneSerializer;
     friend class ScenePanelManager;
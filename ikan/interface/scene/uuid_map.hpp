@@ -0,0 +1,62 @@
+//
+//  uuid_map.hpp
+//  ikan
+//
+//  Created by Ashish . on 17/10/26.
+//
+
+#pragma once
+
+#include <entt.hpp>
+
+namespace ikan {
+
+  /// This class maps the UUID of entity to its entt handle using a flat open addressing hash table (linear probing).
+  ///   - Slots are stored in one contiguous array (no node per entry), capacity is power of 2 and kept at most half full
+  ///   - Erase shifts the following slots back instead of leaving tombstones, so lookups never slow down after many destroys
+  class UUIDMap {
+  public:
+    UUIDMap() = default;
+    DEFAULT_COPY_MOVE_CONSTRUCTORS(UUIDMap);
+
+    /// This function stores the entity of UUID. Replaces the entity if UUID is already present
+    /// - Parameters:
+    ///   - uuid: UUID of entity
+    ///   - entity: entt handle of entity
+    void Insert(uint64_t uuid, entt::entity entity);
+    /// This function removes the UUID. Returns false if UUID is not present
+    /// - Parameter uuid: UUID of entity
+    bool Erase(uint64_t uuid);
+    /// This function returns the entity of UUID. Returns entt::null if not present
+    /// - Parameter uuid: UUID of entity
+    entt::entity Find(uint64_t uuid) const;
+    /// This function returns true if UUID is present
+    /// - Parameter uuid: UUID of entity
+    bool Contains(uint64_t uuid) const { return Find(uuid) != entt::null; }
+
+    /// This function reserves the slots to store num entries without rehash
+    /// - Parameter num_entries: number of entries
+    void Reserve(uint32_t num_entries);
+    /// This function removes all the entries (capacity is kept)
+    void Clear();
+    /// This function returns the number of entries
+    uint32_t Size() const { return size_; }
+
+  private:
+    struct Slot {
+      uint64_t uuid = 0;
+      entt::entity entity = entt::null; // entt::null for empty slot
+    };
+
+    /// This function returns the home slot of UUID
+    /// - Parameter uuid: UUID of entity
+    uint32_t GetHomeSlot(uint64_t uuid) const;
+    /// This function rehashes all entries in new capacity
+    /// - Parameter capacity: new capacity (power of 2)
+    void Rehash(uint32_t capacity);
+
+    std::vector<Slot> slots_;
+    uint32_t size_ = 0;
+  };
+
+} // namespace ikan
@@ -6,3 +6,176 @@
 //
 
 #include "editor.hpp"
+
+namespace editor {
+  
+  void Editor::Init(const std::shared_ptr<Scene> scene, Viewport* viewport) {
+    GameData::Init(scene, viewport);
+    
+    // Scene is changed (open, play or edit), so old handles are not valid
+    benchmark_entities_.clear();
+  }
+  
+  void Editor::RenderGui() {
+    ImGui::Begin("Benchmark");
+    ImGui::DragInt("Quads", &benchmark_count_, 1000.0f, 1, 1000000);
+    PropertyGrid::HoveredMsg("Number of quads to be spawned (100k+ to stress the 2D renderer)");
+    ImGui::Checkbox("Static", &benchmark_static_);
+    PropertyGrid::HoveredMsg("Spawn static quads (rendered from retained chunks)");
+    
+    if (ImGui::Button("Spawn"))
+      SpawnBenchmarkQuads();
+    ImGui::SameLine();
+    if (ImGui::Button("Clear"))
+      ClearBenchmarkQuads();
+    
+    ImGui::Text("Spawned %zu quads", benchmark_entities_.size());
+    
+    ImGui::Separator();
+    if (ImGui::Button("Validate SIMD Quad Corners"))
+      corner_mismatches_ = (int32_t)Math::ValidateQuadCorners2D(100000);
+    PropertyGrid::HoveredMsg("Check SIMD quad corners of batch renderer against scalar reference for 100k random quads");
+    if (corner_mismatches_ >= 0)
+      ImGui::Text("%d corner mismatches", corner_mismatches_);
+    
+    ImGui::Separator();
+    if (ImGui::Button("Texture Slot Benchmark"))
+      RunTextureSlotBenchmark();
+    PropertyGrid::HoveredMsg("Time 100k textured quads submitted to batch renderer with 8, 16 and 64 distinct textures");
+    if (texture_slot_benchmark_ms_[0] >= 0.0f)
+      ImGui::Text("8 : %.2f ms | 16 : %.2f ms | 64 : %.2f ms", texture_slot_benchmark_ms_[0], texture_slot_benchmark_ms_[1],
+                  texture_slot_benchmark_ms_[2]);
+    
+    ImGui::Separator();
+    if (ImGui::Button("Entity Benchmark"))
+      RunEntityBenchmark();
+    PropertyGrid::HoveredMsg("Time create, lookup and destroy of 100k entities in scene (edit state only)");
+    if (entity_benchmark_ms_[0] >= 0.0f) {
+      ImGui::Text("Create %.2f ms | Destroy %.2f ms", entity_benchmark_ms_[0], entity_benchmark_ms_[3]);
+      ImGui::Text("Lookup Id %.2f ms | Lookup UUID %.2f ms", entity_benchmark_ms_[1], entity_benchmark_ms_[2]);
+    }
+    
+    ImGui::Separator();
+    if (ImGui::Button("Scene Copy Benchmark"))
+      RunSceneCopyBenchmark();
+    PropertyGrid::HoveredMsg("Time the copy of scene done when Play is pressed");
+    if (scene_copy_benchmark_ms_ >= 0.0f)
+      ImGui::Text("Scene Copy %.2f ms", scene_copy_benchmark_ms_);
+    ImGui::End();
+  }
+  
+  void Editor::SpawnBenchmarkQuads() {
+    RETURN_IF(!scene_ or benchmark_count_ <= 0);
+    
+    const uint32_t count = (uint32_t)benchmark_count_;
+    const uint32_t columns = (uint32_t)std::ceil(std::sqrt((float)count));
+    const float offset = 0.5f * (float)columns;
+    
+    std::vector<Entity*> entities = scene_->CreateEntities(count, "Benchmark Quad");
+    benchmark_entities_.reserve(benchmark_entities_.size() + count);
+    for (uint32_t i = 0; i < count; i++) {
+      Entity* entity = entities[i];
+      const uint32_t row = i / columns, column = i % columns;
+      
+      entity->GetComponent<TransformComponent>().UpdatePosition({ (float)column - offset, (float)row - offset, 0.0f });
+      auto& qc = entity->AddComponent<QuadComponent>();
+      qc.color = { (float)column / (float)columns, (float)row / (float)columns, 0.5f, 1.0f };
+      qc.is_static = benchmark_static_;
+      
+      benchmark_entities_.push_back((entt::entity)*entity);
+    }
+  }
+  
+  void Editor::ClearBenchmarkQuads() {
+    RETURN_IF(!scene_);
+    scene_->DestroyEntities(benchmark_entities_);
+    benchmark_entities_.clear();
+  }
+  
+  void Editor::RunTextureSlotBenchmark() {
+    static constexpr uint32_t NumQuads = 100000;
+    static constexpr uint32_t TextureCounts[] = { 8, 16, 64 };
+    
+    // 1x1 textures with distinct colors
+    std::vector<std::shared_ptr<Texture>> textures;
+    std::vector<TextureHandle> handles;
+    for (uint32_t i = 0; i < 64; i++) {
+      uint32_t pixel = 0xff000000 | (i * 0x030507);
+      textures.push_back(Texture::Create(1, 1, &pixel, sizeof(uint32_t)));
+      handles.emplace_back(textures.back());
+    }
+    
+    // Zero view projection collapses all the quads, so only the CPU cost of submission and slot lookup is visible in timing
+    const glm::mat4 transform(1.0f);
+    for (size_t c = 0; c < texture_slot_benchmark_ms_.size(); c++) {
+      const uint32_t num_textures = TextureCounts[c];
+      auto start_time = std::chrono::high_resolution_clock::now();
+      
+      Batch2DRenderer::BeginBatch(glm::mat4(0.0f));
+      for (uint32_t i = 0; i < NumQuads; i++)
+        Batch2DRenderer::DrawQuad(transform, handles[i % num_textures]);
+      Batch2DRenderer::EndBatch();
+      
+      auto end_time = std::chrono::high_resolution_clock::now();
+      texture_slot_benchmark_ms_[c] = std::chrono::duration<float, std::milli>(end_time - start_time).count();
+      IK_INFO(GameName(), "Texture slot benchmark: {0} quads, {1} textures in {2} ms", NumQuads, num_textures,
+              texture_slot_benchmark_ms_[c]);
+    }
+  }
+  
+  void Editor::RunEntityBenchmark() {
+    RETURN_IF(!scene_ or !scene_->IsEditing());
+    static constexpr uint32_t NumEntities = 100000;
+    
+    auto elapsed_ms = [](auto start_time) {
+      return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start_time).count();
+    };
+    
+    // Create
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<Entity*> entities = scene_->CreateEntities(NumEntities, "Benchmark Entity");
+    entity_benchmark_ms_[0] = elapsed_ms(start_time);
+    
+    std::vector<entt::entity> handles(NumEntities);
+    std::vector<UUID> uuids(NumEntities);
+    for (uint32_t i = 0; i < NumEntities; i++) {
+      handles[i] = (entt::entity)*entities[i];
+      uuids[i] = entities[i]->GetComponent<IDComponent>().id;
+    }
+    
+    // Lookup. Number of found entities is logged so that loops are not optimised away
+    uint32_t num_found_by_id = 0, num_found_by_uuid = 0;
+    start_time = std::chrono::high_resolution_clock::now();
+    for (auto handle : handles)
+      num_found_by_id += scene_->GetEnitityFromId((int32_t)handle) != nullptr;
+    entity_benchmark_ms_[1] = elapsed_ms(start_time);
+    
+    start_time = std::chrono::high_resolution_clock::now();
+    for (auto uuid : uuids)
+      num_found_by_uuid += scene_->GetEntityFromUUID(uuid) != nullptr;
+    entity_benchmark_ms_[2] = elapsed_ms(start_time);
+    
+    // Destroy
+    start_time = std::chrono::high_resolution_clock::now();
+    scene_->DestroyEntities(handles);
+    entity_benchmark_ms_[3] = elapsed_ms(start_time);
+    
+    IK_INFO(GameName(), "Entity benchmark: {0} entities", NumEntities);
+    IK_INFO(GameName(), "  Create          {0} ms", entity_benchmark_ms_[0]);
+    IK_INFO(GameName(), "  Lookup Id       {0} ms ({1} found)", entity_benchmark_ms_[1], num_found_by_id);
+    IK_INFO(GameName(), "  Lookup UUID     {0} ms ({1} found)", entity_benchmark_ms_[2], num_found_by_uuid);
+    IK_INFO(GameName(), "  Destroy         {0} ms", entity_benchmark_ms_[3]);
+  }
+  
+  void Editor::RunSceneCopyBenchmark() {
+    RETURN_IF(!scene_);
+    
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::shared_ptr<Scene> scene_copy = Scene::Copy(scene_);
+    auto end_time = std::chrono::high_resolution_clock::now();
+    
+    scene_copy_benchmark_ms_ = std::chrono::duration<float, std::milli>(end_time - start_time).count();
+    IK_INFO(GameName(), "Scene copy benchmark: {0} entities in {1} ms", scene_copy->GetNumEntities(), scene_copy_benchmark_ms_);
+  }
+  
+} // namespace editor
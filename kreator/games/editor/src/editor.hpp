@@ -16,9 +16,10 @@ namespace editor {
   
   class Editor : public GameData {
   public:
-    void Init(const std::shared_ptr<Scene> scene, Viewport* viewport) override {};
+    void Init(const std::shared_ptr<Scene> scene, Viewport* viewport) override;
     void Update(Timestep ts) override {}
     void SetViewportSize(uint32_t width, uint32_t height) override {}
+    void RenderGui() override;
 
     std::string GameName() const override { return "Kreator Editor"; }
     glm::vec4 GetBgColor() const override { return {0.5f, 0.2f, 0.2f, 1.0f}; }
@@ -35,6 +36,32 @@ namespace editor {
         DM::ClientAsset("prefabs"),
       };
     };
+    
+  private:
+    /// This function spawns the benchmark quads in a grid around origin, in one batch
+    void SpawnBenchmarkQuads();
+    /// This function destroys all the benchmark quads
+    void ClearBenchmarkQuads();
+    /// This function times 100k textured quads submitted to batch renderer, cycling over 8, 16 and 64 distinct textures
+    void RunTextureSlotBenchmark();
+    /// This function times create, lookup (by id and by UUID) and destroy of 100k entities in scene. Runs only in edit state, as
+    /// destroy is deferred in play
+    void RunEntityBenchmark();
+    /// This function times the copy of scene done when Play is pressed
+    void RunSceneCopyBenchmark();
+    
+    // Benchmark data: renderer stress scene with large number of quads
+    int32_t benchmark_count_ = 100000;
+    bool benchmark_static_ = false;
+    std::vector<entt::entity> benchmark_entities_;
+    /// Result of last SIMD quad corner validation. -1 if not validated yet
+    int32_t corner_mismatches_ = -1;
+    /// Time (ms) of last texture slot benchmark, for each texture count. Negative if not run yet
+    std::array<float, 3> texture_slot_benchmark_ms_ = { -1.0f, -1.0f, -1.0f };
+    /// Time (ms) of last entity benchmark: create, lookup by id, lookup by UUID and destroy. Negative if not run yet
+    std::array<float, 4> entity_benchmark_ms_ = { -1.0f, -1.0f, -1.0f, -1.0f };
+    /// Time (ms) of last scene copy benchmark. Negative if not run yet
+    float scene_copy_benchmark_ms_ = -1.0f;
   };
   
 } // namespace editor
@@ -127,7 +127,8 @@ namespace mario {
     qc.sprite.ClearSprites();
     qc.sprite.ClearTextures();
     qc.sprite.texture.push_back(SpriteManager::GetTexture(SpriteType::Items));
-    qc.sprite.sprite_images = SpriteManager::GetItemSprite(Items::InactiveBlock);
+    qc.sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Items), SpriteManager::GetItemSprite(Items::InactiveBlock));
+    qc.MarkModified();
         
     active_ = false;
   }
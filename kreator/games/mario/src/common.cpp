@@ -11,7 +11,7 @@
 
 namespace mario {
   
-  QuadComponent* MarioPrefab::AddQuad(Entity *entity, TextureRef tex, const std::vector<SubTextureRef>& sprites) {
+  QuadComponent* MarioPrefab::AddQuad(Entity *entity, const SpriteSheetRef& sprite_sheet, SpriteSheet::ClipID clip) {
     QuadComponent* qc = GET_COMPONENT(QuadComponent);
     
     qc->sprite.use = true;
@@ -19,14 +19,10 @@ namespace mario {
     qc->sprite.linear_edge = false;
     
     qc->sprite.ClearTextures();
-    qc->sprite.texture.push_back(tex);
+    qc->sprite.texture.push_back(sprite_sheet->GetTexture());
     
     qc->sprite.ClearSprites();
-    for (const auto& sprite : sprites) {
-      if (sprite) {
-        qc->sprite.sprite_images.emplace_back(sprite);
-      }
-    }
+    qc->sprite.SetSpriteClip(sprite_sheet, clip);
     return qc;
   }
   
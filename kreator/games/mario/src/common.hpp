@@ -9,6 +9,7 @@
 
 #define TextureRef std::shared_ptr<Texture>
 #define SubTextureRef std::shared_ptr<SubTexture>
+#define SpriteSheetRef std::shared_ptr<SpriteSheet>
 #define MARIO_LOG(...) IK_TRACE("Mario", __VA_ARGS__);
 
 
@@ -29,9 +30,9 @@ namespace mario {
     /// This function add the quad component if not present else add the required parameter
     /// - Parameters:
     ///   - entity: enity
-    ///   - tex: texture to be added
-    ///   - sprites: sprites vecotr
-    static QuadComponent* AddQuad(Entity* entity, TextureRef tex, const std::vector<SubTextureRef>& sprites);
+    ///   - sprite_sheet: sprite sheet to be added
+    ///   - clip: animation clip of sprite sheet
+    static QuadComponent* AddQuad(Entity* entity, const SpriteSheetRef& sprite_sheet, SpriteSheet::ClipID clip);
     /// This function add the Ridig Body component if not present else add the required parameter
     /// - Parameters:
     ///   - entity: entity
@@ -171,7 +171,7 @@ namespace mario {
       reset_fixture_ = true;
       
       auto& qc = entity_.GetComponent<QuadComponent>();
-      qc.sprite.sprite_images = SpriteManager::GetEnemySprite(EnemyType::Goomba, EnemyState::Dying);
+      qc.sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Enemy), SpriteManager::GetEnemySprite(EnemyType::Goomba, EnemyState::Dying));
       
       const auto& tc = entity_.GetComponent<TransformComponent>();
       RuntimeItemManager::Spawn(Items::Score, entity_.scene_, {tc.Position().x, tc.Position().y + 1}, score::EnemyKill);
@@ -228,7 +228,8 @@ namespace mario {
       
       if (is_dead_) {
         entity_.GetComponent<TransformComponent>().UpdateScale(Y, 1.0f);
-        entity_.GetComponent<QuadComponent>().sprite.sprite_images = SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Dying);
+        entity_.GetComponent<QuadComponent>().sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Enemy),
+                                                                   SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Dying));
       }
     }
     
@@ -252,7 +253,7 @@ namespace mario {
 
       auto& qc = entity_.GetComponent<QuadComponent>();
       if (time_to_revive_ > 0.0f and time_to_revive_ <= 1.0f ) {
-        qc.sprite.sprite_images = SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Revive);
+        qc.sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Enemy), SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Revive));
       }
       else if (time_to_revive_ <= 0.0f) {
         height_ = 2.0f;
@@ -263,7 +264,7 @@ namespace mario {
         pbc.offset.y = -0.20f;
         pbc.RecalculateColliders();
 
-        qc.sprite.sprite_images = SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Alive);
+        qc.sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Enemy), SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Alive));
 
         // Add Impulse to push e out of ground while changing size
         rbc.ApplyImpulseToCenter({0, 1.0});
@@ -305,7 +306,7 @@ namespace mario {
       pbc.RecalculateColliders();
       
       auto& qc = entity_.GetComponent<QuadComponent>();
-      qc.sprite.sprite_images = SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Dying);
+      qc.sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Enemy), SpriteManager::GetEnemySprite(EnemyType::Turtle, EnemyState::Dying));
 
       reset_fixture_ = true;
 
@@ -67,14 +67,15 @@ namespace mario {
     text_data_.Render(score, 1, 0);
     
     Batch2DRenderer::BeginBatch(FixedCamera::projection);
-    static std::vector<SubTextureRef> coin_subtex = SpriteManager::GetItemSprite(Items::AnimatedCoin);
+    const auto& item_sheet = SpriteManager::GetSpriteSheet(SpriteType::Items);
+    SpriteSheet::ClipID coin_clip = SpriteManager::GetItemSprite(Items::AnimatedCoin);
     static int32_t anim_idx = 0;
     float speed = 20.0f;
-    if (anim_idx >= speed * coin_subtex.size() or anim_idx < 1)
+    if (anim_idx >= speed * item_sheet->GetClip(coin_clip).num_frames or anim_idx < 1)
       anim_idx = 0;
     
     Batch2DRenderer::DrawQuad(Math::GetTransformMatrix({text_data_.col_pos[1] - 10, text_data_.row_pos[1] + 8, 0}, {0, 0, 0}, {22, 22, 1}),
-                              coin_subtex.at(anim_idx / speed), {1, 1, 1, 1});
+                              *item_sheet, item_sheet->GetClipFrame(coin_clip, (uint32_t)(anim_idx / speed)), {1, 1, 1, 1});
     anim_idx++;
     Batch2DRenderer::EndBatch();
     
@@ -122,7 +123,7 @@ namespace mario {
     }
     
     // Add Essentials Components
-    MarioPrefab::AddQuad(&player_entity, SM::GetTexture(SpriteType::Player),
+    MarioPrefab::AddQuad(&player_entity, SM::GetSpriteSheet(SpriteType::Player),
                          SM::GetPlayerSprite(PlayerState::Small, PlayerAction::Idle, PlayerAction::Idle));
     MarioPrefab::AddRigidBody(&player_entity, RigidBodyComponent::RbBodyType::Dynamic);
     MarioPrefab::AddPillBoxCollider(&player_entity, {0.4f, 0.5f});
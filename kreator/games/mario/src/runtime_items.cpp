@@ -178,7 +178,8 @@ namespace mario {
     }
     
     if (destroy_) {
-      entity_.GetComponent<QuadComponent>().sprite.sprite_images = SpriteManager::GetItemSprite(Items::BigFireball);
+      entity_.GetComponent<QuadComponent>().sprite.SetSpriteClip(SpriteManager::GetSpriteSheet(SpriteType::Items),
+                                                                 SpriteManager::GetItemSprite(Items::BigFireball));
       entity_.GetComponent<TransformComponent>().UpdateScale({1, 1, 1});
 
       destroy_time_ -= ts;
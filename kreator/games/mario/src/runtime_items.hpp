@@ -158,7 +158,7 @@ namespace mario {
                                                 ScriptLoader(mario::ScoreController, std::forward<Args>(args)...), std::forward<Args>(args)...);
       }
       else {
-        MarioPrefab::AddQuad(&run_time_entity, SpriteManager::GetTexture(SpriteType::Items), SpriteManager::GetItemSprite(item));
+        MarioPrefab::AddQuad(&run_time_entity, SpriteManager::GetSpriteSheet(SpriteType::Items), SpriteManager::GetItemSprite(item));
         MarioPrefab::AddScript(&run_time_entity, data_->item_map.at(item).scrip_name, data_->item_map.at(item).loader_fun);
       }
       
@@ -15,14 +15,16 @@ namespace mario {
   struct SpriteData {
     // Stores the Texture of all Sprite type
     std::unordered_map<SpriteType, TextureRef> texture_map;
-    // Stores the Subtextures of Player for each Action and State Combination
-    std::unordered_map<PlayerState, std::unordered_map<PlayerAction, std::vector<SubTextureRef>>> player_subtextures_map;
-    // Stores the Subtextures of Player for each Action and State Combination
-    std::unordered_map<PlayerAction, std::vector<SubTextureRef>> invinc_player_subtextures_map;
-    // Stores the Runtime Item Subtextures
-    std::unordered_map<Items, std::vector<SubTextureRef>> item_subtextures_map;
-    // Stores the Enemy Textures based on type and state
-    std::unordered_map<EnemyType, std::unordered_map<EnemyState, std::vector<SubTextureRef>>> enemy_subtextures_map;
+    // Stores the Sprite sheet (frame UVs and clips) of all Sprite type having sprites
+    std::unordered_map<SpriteType, SpriteSheetRef> sprite_sheet_map;
+    // Stores the Clips of Player for each Action and State Combination
+    std::unordered_map<PlayerState, std::unordered_map<PlayerAction, SpriteSheet::ClipID>> player_clip_map;
+    // Stores the Clips of Invincible Player for each Action
+    std::unordered_map<PlayerAction, SpriteSheet::ClipID> invinc_player_clip_map;
+    // Stores the Runtime Item Clips
+    std::unordered_map<Items, SpriteSheet::ClipID> item_clip_map;
+    // Stores the Enemy Clips based on type and state
+    std::unordered_map<EnemyType, std::unordered_map<EnemyState, SpriteSheet::ClipID>> enemy_clip_map;
   };
   static std::shared_ptr<SpriteData> data_;
 
@@ -34,92 +36,82 @@ namespace mario {
     data_->texture_map[SpriteType::Items] = Renderer::GetTexture(DM::ClientAsset("textures/item.png"), false);
     data_->texture_map[SpriteType::Enemy] = Renderer::GetTexture(DM::ClientAsset("textures/enemy.png"), false);
     data_->texture_map[SpriteType::Tile] = Renderer::GetTexture(DM::ClientAsset("textures/tile.png"), false);
-    data_->texture_map[SpriteType::Enemy] = Renderer::GetTexture(DM::ClientAsset("textures/enemy.png"), false);
 
     // Player
-    const auto& player_sprite = GetTexture(SpriteType::Player);
+    auto& player_sheet = data_->sprite_sheet_map[SpriteType::Player];
+    player_sheet = SpriteSheet::Create(GetTexture(SpriteType::Player));
     
     // Small Player
-    auto& small_player_map = data_->player_subtextures_map[PlayerState::Small];
-    small_player_map[PlayerAction::Idle].push_back(SubTexture::CreateFromCoords(player_sprite, {6.0f, 30.0f}));
-    small_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {0.0f, 30.0f}));
-    small_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {1.0f, 30.0f}));
-    small_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {2.0f, 30.0f}));
-    small_player_map[PlayerAction::SwitchSide].push_back(SubTexture::CreateFromCoords(player_sprite, {3.0f, 30.0f}));
-    small_player_map[PlayerAction::Jump].push_back(SubTexture::CreateFromCoords(player_sprite, {4.0f, 30.0f}));
-    small_player_map[PlayerAction::Die].push_back(SubTexture::CreateFromCoords(player_sprite, {5.0f, 30.0f}));
-    small_player_map[PlayerAction::PowerUp].push_back(SubTexture::CreateFromCoords(player_sprite, {6.0f, 30.0f}));
-    small_player_map[PlayerAction::PowerUp].push_back(SubTexture::CreateFromCoords(player_sprite, {15.0f, 31.0f}, {1.0f, 2.0f}));
+    auto& small_player_map = data_->player_clip_map[PlayerState::Small];
+    small_player_map[PlayerAction::Idle] = player_sheet->AddClip({ {{6.0f, 30.0f}} });
+    small_player_map[PlayerAction::Run] = player_sheet->AddClip({ {{0.0f, 30.0f}}, {{1.0f, 30.0f}}, {{2.0f, 30.0f}} });
+    small_player_map[PlayerAction::SwitchSide] = player_sheet->AddClip({ {{3.0f, 30.0f}} });
+    small_player_map[PlayerAction::Jump] = player_sheet->AddClip({ {{4.0f, 30.0f}} });
+    small_player_map[PlayerAction::Die] = player_sheet->AddClip({ {{5.0f, 30.0f}} });
+    small_player_map[PlayerAction::PowerUp] = player_sheet->AddClip({ {{6.0f, 30.0f}}, {{15.0f, 31.0f}, {1.0f, 2.0f}} });
     
     // Big Player
-    auto& big_player_map = data_->player_subtextures_map[PlayerState::Big];
-    big_player_map[PlayerAction::Idle].push_back(SubTexture::CreateFromCoords(player_sprite, {6.0f, 31.0f}, {1.0f, 2.0f}));
-    big_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {0.0f, 31.0f}, {1.0f, 2.0f}));
-    big_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {1.0f, 31.0f}, {1.0f, 2.0f}));
-    big_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {2.0f, 31.0f}, {1.0f, 2.0f}));
-    big_player_map[PlayerAction::SwitchSide].push_back(SubTexture::CreateFromCoords(player_sprite, {3.0f, 31.0f}, {1.0f, 2.0f}));
-    big_player_map[PlayerAction::Jump].push_back(SubTexture::CreateFromCoords(player_sprite, {4.0f, 31.0f}, {1.0f, 2.0f}));
+    auto& big_player_map = data_->player_clip_map[PlayerState::Big];
+    big_player_map[PlayerAction::Idle] = player_sheet->AddClip({ {{6.0f, 31.0f}, {1.0f, 2.0f}} });
+    big_player_map[PlayerAction::Run] = player_sheet->AddClip({ {{0.0f, 31.0f}, {1.0f, 2.0f}}, {{1.0f, 31.0f}, {1.0f, 2.0f}}, {{2.0f, 31.0f}, {1.0f, 2.0f}} });
+    big_player_map[PlayerAction::SwitchSide] = player_sheet->AddClip({ {{3.0f, 31.0f}, {1.0f, 2.0f}} });
+    big_player_map[PlayerAction::Jump] = player_sheet->AddClip({ {{4.0f, 31.0f}, {1.0f, 2.0f}} });
     
     // Fire Player
-    auto& fire_player_map = data_->player_subtextures_map[PlayerState::Fire];
-    fire_player_map[PlayerAction::Idle].push_back(SubTexture::CreateFromCoords(player_sprite, {6.0f, 28.0f}, {1.0f, 2.0f}));
-    fire_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {0.0f, 28.0f}, {1.0f, 2.0f}));
-    fire_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {1.0f, 28.0f}, {1.0f, 2.0f}));
-    fire_player_map[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {2.0f, 28.0f}, {1.0f, 2.0f}));
-    fire_player_map[PlayerAction::SwitchSide].push_back(SubTexture::CreateFromCoords(player_sprite, {3.0f, 28.0f}, {1.0f, 2.0f}));
-    fire_player_map[PlayerAction::Jump].push_back(SubTexture::CreateFromCoords(player_sprite, {4.0f, 28.0f}, {1.0f, 2.0f}));
-    
-    auto& invinc_player_subtexture = data_->invinc_player_subtextures_map;
+    auto& fire_player_map = data_->player_clip_map[PlayerState::Fire];
+    fire_player_map[PlayerAction::Idle] = player_sheet->AddClip({ {{6.0f, 28.0f}, {1.0f, 2.0f}} });
+    fire_player_map[PlayerAction::Run] = player_sheet->AddClip({ {{0.0f, 28.0f}, {1.0f, 2.0f}}, {{1.0f, 28.0f}, {1.0f, 2.0f}}, {{2.0f, 28.0f}, {1.0f, 2.0f}} });
+    fire_player_map[PlayerAction::SwitchSide] = player_sheet->AddClip({ {{3.0f, 28.0f}, {1.0f, 2.0f}} });
+    fire_player_map[PlayerAction::Jump] = player_sheet->AddClip({ {{4.0f, 28.0f}, {1.0f, 2.0f}} });
+    
+    // Invincible Player cycles all the colors of an action
+    std::vector<SpriteSheet::Frame> invinc_idle, invinc_run, invinc_switch_side;
     for (int32_t i = 0; i < 5; i++) {
-      invinc_player_subtexture[PlayerAction::Idle].push_back(SubTexture::CreateFromCoords(player_sprite, {6.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}));
-      invinc_player_subtexture[PlayerAction::Run].push_back(SubTexture::CreateFromCoords(player_sprite, {1.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}));
-      invinc_player_subtexture[PlayerAction::SwitchSide].push_back(SubTexture::CreateFromCoords(player_sprite, {3.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}));
-      invinc_player_subtexture[PlayerAction::Jump].push_back(SubTexture::CreateFromCoords(player_sprite, {3.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}));
+      invinc_idle.push_back({{6.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}});
+      invinc_run.push_back({{1.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}});
+      invinc_switch_side.push_back({{3.0f, 31.0f - (3 * i)}, {1.0f, 2.0f}});
     }
+    auto& invinc_player_map = data_->invinc_player_clip_map;
+    invinc_player_map[PlayerAction::Idle] = player_sheet->AddClip(invinc_idle);
+    invinc_player_map[PlayerAction::Run] = player_sheet->AddClip(invinc_run);
+    invinc_player_map[PlayerAction::SwitchSide] = player_sheet->AddClip(invinc_switch_side);
+    
+    // Jump uses same frames as Switch Side
+    const auto& switch_side_clip = player_sheet->GetClip(invinc_player_map.at(PlayerAction::SwitchSide));
+    invinc_player_map[PlayerAction::Jump] = player_sheet->AddClip(switch_side_clip.first_frame, switch_side_clip.num_frames);
 
     // Items
-    auto& item_sprite = data_->texture_map[SpriteType::Items];
-    data_->item_subtextures_map[Items::Coin].push_back(SubTexture::CreateFromCoords(item_sprite, {0.0f, 14.0f}));
-    
-    data_->item_subtextures_map[Items::AnimatedCoin].push_back(SubTexture::CreateFromCoords(item_sprite, {0.0f, 13.0f}));
-    data_->item_subtextures_map[Items::AnimatedCoin].push_back(SubTexture::CreateFromCoords(item_sprite, {1.0f, 13.0f}));
-    data_->item_subtextures_map[Items::AnimatedCoin].push_back(SubTexture::CreateFromCoords(item_sprite, {2.0f, 13.0f}));
-    data_->item_subtextures_map[Items::AnimatedCoin].push_back(SubTexture::CreateFromCoords(item_sprite, {3.0f, 13.0f}));
-    
-    data_->item_subtextures_map[Items::Mushroom].push_back(SubTexture::CreateFromCoords(item_sprite, {0.0f, 19.0f}));
-    
-    data_->item_subtextures_map[Items::Flower].push_back(SubTexture::CreateFromCoords(item_sprite, {0.0f, 18.0f}));
-    data_->item_subtextures_map[Items::Flower].push_back(SubTexture::CreateFromCoords(item_sprite, {1.0f, 18.0f}));
-    data_->item_subtextures_map[Items::Flower].push_back(SubTexture::CreateFromCoords(item_sprite, {2.0f, 18.0f}));
-    data_->item_subtextures_map[Items::Flower].push_back(SubTexture::CreateFromCoords(item_sprite, {3.0f, 18.0f}));
-    
-    data_->item_subtextures_map[Items::Fireball].push_back(SubTexture::CreateFromCoords(item_sprite, {6.0f, 11.0f}, {0.5f, 0.5f}));
-    data_->item_subtextures_map[Items::Fireball].push_back(SubTexture::CreateFromCoords(item_sprite, {6.5f, 11.0f}, {0.5f, 0.5f}));
-    data_->item_subtextures_map[Items::Fireball].push_back(SubTexture::CreateFromCoords(item_sprite, {6.0f, 11.5f}, {0.5f, 0.5f}));
-    data_->item_subtextures_map[Items::Fireball].push_back(SubTexture::CreateFromCoords(item_sprite, {6.5f, 11.5f}, {0.5f, 0.5f}));
-    
-    data_->item_subtextures_map[Items::BigFireball].push_back(SubTexture::CreateFromCoords(item_sprite, {7.0f, 9.0f}));
-    data_->item_subtextures_map[Items::InactiveBlock].push_back(SubTexture::CreateFromCoords(item_sprite, {3.0f, 8.0f}));
+    auto& item_sheet = data_->sprite_sheet_map[SpriteType::Items];
+    item_sheet = SpriteSheet::Create(GetTexture(SpriteType::Items));
+    
+    auto& item_map = data_->item_clip_map;
+    item_map[Items::Coin] = item_sheet->AddClip({ {{0.0f, 14.0f}} });
+    item_map[Items::AnimatedCoin] = item_sheet->AddClip({ {{0.0f, 13.0f}}, {{1.0f, 13.0f}}, {{2.0f, 13.0f}}, {{3.0f, 13.0f}} });
+    item_map[Items::Mushroom] = item_sheet->AddClip({ {{0.0f, 19.0f}} });
+    item_map[Items::Flower] = item_sheet->AddClip({ {{0.0f, 18.0f}}, {{1.0f, 18.0f}}, {{2.0f, 18.0f}}, {{3.0f, 18.0f}} });
+    item_map[Items::Fireball] = item_sheet->AddClip({ {{6.0f, 11.0f}, {0.5f, 0.5f}}, {{6.5f, 11.0f}, {0.5f, 0.5f}},
+                                                      {{6.0f, 11.5f}, {0.5f, 0.5f}}, {{6.5f, 11.5f}, {0.5f, 0.5f}} });
+    item_map[Items::BigFireball] = item_sheet->AddClip({ {{7.0f, 9.0f}} });
+    item_map[Items::InactiveBlock] = item_sheet->AddClip({ {{3.0f, 8.0f}} });
 
     // Enemy
-    const auto& enemy_sprite = GetTexture(SpriteType::Enemy);
-    auto& goomba_sprite = data_->enemy_subtextures_map[EnemyType::Goomba];
-    goomba_sprite[EnemyState::Alive].push_back(SubTexture::CreateFromCoords(enemy_sprite, {0.0f, 6.0f}));
-    goomba_sprite[EnemyState::Alive].push_back(SubTexture::CreateFromCoords(enemy_sprite, {1.0f, 6.0f}));
-    goomba_sprite[EnemyState::Dying].push_back(SubTexture::CreateFromCoords(enemy_sprite, {2.0f, 6.0f}));
+    auto& enemy_sheet = data_->sprite_sheet_map[SpriteType::Enemy];
+    enemy_sheet = SpriteSheet::Create(GetTexture(SpriteType::Enemy));
     
-    auto& turtle_sprite = data_->enemy_subtextures_map[EnemyType::Turtle];
-    turtle_sprite[EnemyState::Alive].push_back(SubTexture::CreateFromCoords(enemy_sprite, {6.0f, 6.0f}, {1.0f, 2.0f}));
-    turtle_sprite[EnemyState::Alive].push_back(SubTexture::CreateFromCoords(enemy_sprite, {7.0f, 6.0f}, {1.0f, 2.0f}));
-    turtle_sprite[EnemyState::Dying].push_back(SubTexture::CreateFromCoords(enemy_sprite, {10.0f, 6.0f}));
-
-    turtle_sprite[EnemyState::Revive].push_back(SubTexture::CreateFromCoords(enemy_sprite, {11.0f, 6.0f}));
-    turtle_sprite[EnemyState::Revive].push_back(SubTexture::CreateFromCoords(enemy_sprite, {10.0f, 6.0f}));
+    auto& goomba_map = data_->enemy_clip_map[EnemyType::Goomba];
+    goomba_map[EnemyState::Alive] = enemy_sheet->AddClip({ {{0.0f, 6.0f}}, {{1.0f, 6.0f}} });
+    goomba_map[EnemyState::Dying] = enemy_sheet->AddClip({ {{2.0f, 6.0f}} });
+    
+    auto& turtle_map = data_->enemy_clip_map[EnemyType::Turtle];
+    turtle_map[EnemyState::Alive] = enemy_sheet->AddClip({ {{6.0f, 6.0f}, {1.0f, 2.0f}}, {{7.0f, 6.0f}, {1.0f, 2.0f}} });
+    turtle_map[EnemyState::Dying] = enemy_sheet->AddClip({ {{10.0f, 6.0f}} });
+    turtle_map[EnemyState::Revive] = enemy_sheet->AddClip({ {{11.0f, 6.0f}}, {{10.0f, 6.0f}} });
 
     MARIO_LOG("Initialised the Sprite Manager");
   }
   
   void SpriteManager::Shutdown() {
+    data_->sprite_sheet_map.clear();
     data_->texture_map.clear();
     data_.reset();
     
@@ -131,36 +123,43 @@ namespace mario {
       return data_->texture_map.at(type);
     return nullptr;
   }
+  
+  const SpriteSheetRef& SpriteManager::GetSpriteSheet(SpriteType type) {
+    static const SpriteSheetRef no_sprite_sheet;
+    if (data_ and data_->sprite_sheet_map.find(type) != data_->sprite_sheet_map.end())
+      return data_->sprite_sheet_map.at(type);
+    return no_sprite_sheet;
+  }
 
-  const std::vector<SubTextureRef>& SpriteManager::GetPlayerSprite(PlayerState state, PlayerAction action, PlayerAction prev_action) {
+  SpriteSheet::ClipID SpriteManager::GetPlayerSprite(PlayerState state, PlayerAction action, PlayerAction prev_action) {
     // For Powerup while Big we need to animate the Player to all color based on the prev action
     if (action == PlayerAction::PowerUp and state == PlayerState::Big) {
-      const auto& invince_player_map = data_->invinc_player_subtextures_map;
+      const auto& invince_player_map = data_->invinc_player_clip_map;
       IK_ASSERT(invince_player_map.find(prev_action) != invince_player_map.end());
       
       return invince_player_map.at(prev_action);
     }
 
-    IK_ASSERT(data_ or data_->player_subtextures_map.find(state) != data_->player_subtextures_map.end());
+    IK_ASSERT(data_ or data_->player_clip_map.find(state) != data_->player_clip_map.end());
     
-    const auto& player_map = data_->player_subtextures_map.at(state);
+    const auto& player_map = data_->player_clip_map.at(state);
     IK_ASSERT(player_map.find(action) != player_map.end());
     
     return player_map.at(action);
   }
   
-  const std::vector<std::shared_ptr<SubTexture>>& SpriteManager::GetEnemySprite(EnemyType type, EnemyState state) {
-    IK_ASSERT(data_ or data_->enemy_subtextures_map.find(type) != data_->enemy_subtextures_map.end());
+  SpriteSheet::ClipID SpriteManager::GetEnemySprite(EnemyType type, EnemyState state) {
+    IK_ASSERT(data_ or data_->enemy_clip_map.find(type) != data_->enemy_clip_map.end());
     
-    const auto& enemy_map = data_->enemy_subtextures_map.at(type);
+    const auto& enemy_map = data_->enemy_clip_map.at(type);
     IK_ASSERT(enemy_map.find(state) != enemy_map.end());
     
     return enemy_map.at(state);
   }
 
-  std::vector<SubTextureRef> SpriteManager::GetItemSprite(Items item) {
-    IK_ASSERT(data_ or data_->item_subtextures_map.find(item) != data_->item_subtextures_map.end());
-    return data_->item_subtextures_map.at(item);
+  SpriteSheet::ClipID SpriteManager::GetItemSprite(Items item) {
+    IK_ASSERT(data_ or data_->item_clip_map.find(item) != data_->item_clip_map.end());
+    return data_->item_clip_map.at(item);
   }
 
 } // namespace mario
@@ -33,19 +33,22 @@ namespace mario {
     /// This function returns the texture of a sprite type
     /// - Parameter type: sprite type to return the texture
     static TextureRef GetTexture(SpriteType type);
-    /// This function returns all the subtextures in vector requred for an action for a player state
+    /// This function returns the sprite sheet of a sprite type (nullptr for tiles)
+    /// - Parameter type: sprite type to return the sprite sheet
+    static const SpriteSheetRef& GetSpriteSheet(SpriteType type);
+    /// This function returns the clip (in player sprite sheet) requred for an action for a player state
     /// - Parameters:
     ///   - state: player state
     ///   - action: player action
-    static const std::vector<SubTextureRef>& GetPlayerSprite(PlayerState state, PlayerAction action, PlayerAction prev_action);
-    /// This function returns the subtexture of enemy based on state and type
+    static SpriteSheet::ClipID GetPlayerSprite(PlayerState state, PlayerAction action, PlayerAction prev_action);
+    /// This function returns the clip (in enemy sprite sheet) of enemy based on state and type
     /// - Parameters:
     ///   - type: type of enemy
     ///   - state: state of enemy
-    static const std::vector<SubTextureRef>& GetEnemySprite(EnemyType type, EnemyState state);
-    /// This Function returns the Runtime Item Subtexture
+    static SpriteSheet::ClipID GetEnemySprite(EnemyType type, EnemyState state);
+    /// This Function returns the Runtime Item clip (in item sprite sheet)
     /// - Parameter type: Item Type
-    static std::vector<SubTextureRef> GetItemSprite(Items type);
+    static SpriteSheet::ClipID GetItemSprite(Items type);
 
     MAKE_PURE_STATIC(SpriteManager);
   };
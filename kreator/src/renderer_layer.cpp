@@ -21,6 +21,12 @@ namespace kreator {
     flag = (flag) ? false : true; \
   }
   
+  /// This function returns the path of texture atlas file of scene (next to scene file)
+  /// - Parameter scene_path: path of scene file
+  static std::string GetTextureAtlasPath(const std::string& scene_path) {
+    return std::filesystem::path(scene_path).replace_extension(".ikanAtlas").string();
+  }
+  
   std::shared_ptr<ScenePanelManager> RendererLayer::spm_;
   RendererLayer::Setting RendererLayer::setting_;
   bool RendererLayer::is_playing_ = false;
@@ -221,6 +227,7 @@ namespace kreator {
         ImguiAPI::Framerate(&setting_.frame_rate.flag);
         Renderer::RenderStatsGui(&setting_.common_renderer_stats.flag);
         Renderer::Render2DStatsGui(&setting_.renderer_stats_2d.flag);
+        Renderer::RenderTextureLibraryGui(&setting_.texture_library.flag);
         viewport_.RenderGui(&setting_.viewport_data.flag);
         
         CBP::RenderGui(&setting_.content_browser_panel.flag);
@@ -292,6 +299,8 @@ namespace kreator {
         ImguiAPI::Menu("Scene", true, [this]() {
           if (ImGui::MenuItem("New", "Cmd + N"))    NewScene();
           if (ImGui::MenuItem("Close", "Cmd + X"))  CloseScene();
+          ImGui::Separator();
+          if (ImGui::MenuItem("Pack Texture Atlas")) PackTextureAtlas();
         }); // Scene
         
         ImGui::Separator();
@@ -534,11 +543,30 @@ namespace kreator {
     SceneSerializer serializer(editor_scene_.get());
     
     bool result = serializer.Deserialize(scene_path);
+    
+    // Atlas packed for this scene by PackTextureAtlas()
+    const std::string atlas_path = GetTextureAtlasPath(scene_path);
+    if (std::filesystem::exists(atlas_path))
+      editor_scene_->SetTextureAtlas(TextureAtlas::Load(atlas_path));
     game_data_->Init(active_scene_, &viewport_);
     
     return result;
   }
   
+  void RendererLayer::PackTextureAtlas() {
+    if (!editor_scene_ or !start_from_begin_ or editor_scene_->GetFilePath().empty()) return;
+    
+    // Pages take the filter used by most of the textures. Textures with other filter are drawn from their own texture
+    TextureAtlas::Specification spec;
+    std::vector<std::string> linear_paths = editor_scene_->GetQuadTexturePaths(true);
+    std::vector<std::string> nearest_paths = editor_scene_->GetQuadTexturePaths(false);
+    spec.linear = linear_paths.size() >= nearest_paths.size();
+    
+    const std::string atlas_path = GetTextureAtlasPath(editor_scene_->GetFilePath());
+    if (TextureAtlas::Pack(spec.linear ? linear_paths : nearest_paths, atlas_path, spec))
+      editor_scene_->SetTextureAtlas(TextureAtlas::Load(atlas_path));
+  }
+  
   void RendererLayer::RenderGrid() {
     const auto& cd = active_scene_->GetPrimaryCameraData();
     if (cd.scene_camera)
@@ -636,26 +664,35 @@ namespace kreator {
       if (entity->HasComponent<QuadComponent>()) {
         auto& qc = entity->GetComponent<QuadComponent>();
         (enable) ? qc.color.a -=0.2f : qc.color.a +=0.2f;
+        qc.MarkModified();
       }
     }
   }
   
   void RendererLayer::DeleteSelectedEntities() {
+    std::vector<entt::entity> entities;
+    entities.reserve(selected_entities_.size());
     for (auto& [entt, entity] : selected_entities_) {
+      if (!entity) continue;
       if (spm_->GetSelectedEntity() and *(spm_->GetSelectedEntity()) == *entity) {
         spm_->SetSelectedEntity(nullptr);
       }
-      active_scene_->DestroyEntity(*entity);
+      entities.push_back(entt);
     }
+    active_scene_->DestroyEntities(entities);
     selected_entities_.clear();
   }
   
   void RendererLayer::DuplicateSelectedEntities() {
-    HighlightSelectedEntities(false);
+    std::vector<entt::entity> entities;
+    entities.reserve(selected_entities_.size());
     for (auto& [entt, entity] : selected_entities_) {
       if (entity)
-        [[maybe_unused]] auto e = active_scene_->DuplicateEntity(*entity);
+        entities.push_back(entt);
     }
+    
+    HighlightSelectedEntities(false);
+    active_scene_->DuplicateEntities(entities);
     HighlightSelectedEntities(true);
   }
   
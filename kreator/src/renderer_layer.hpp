@@ -36,6 +36,7 @@ namespace kreator {
       SettingWrapper frame_rate{"Frame Rate", true};
       SettingWrapper common_renderer_stats{"Common Renderer Stats", true};
       SettingWrapper renderer_stats_2d{"2D Renderer Stats", true};
+      SettingWrapper texture_library{"Texture Library", false};
       SettingWrapper save_scene{"Save Scene Panel", true};
       SettingWrapper prefab_loader{"Prefab Loader Panel", true};
     };
@@ -118,6 +119,9 @@ namespace kreator {
     /// This function opens already saved scene from path
     /// - Parameter scene_file_path: scene file path
     const bool OpenScene(const std::string& scene_file_path);
+    /// This function packs the quad textures of editor scene in atlas file next to scene file (offline packing step), and renders the
+    /// scene with the atlas. Atlas file is loaded again when scene is opened
+    void PackTextureAtlas();
 
     /// This function set the game state
     /// - Parameter is_play: game state